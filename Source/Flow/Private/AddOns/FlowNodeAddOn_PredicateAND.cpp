@@ -1,6 +1,8 @@
 // Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
 
 #include "AddOns/FlowNodeAddOn_PredicateAND.h"
+#include "FlowSettings.h"
+#include "Types/FlowDataPinResolveCache.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNodeAddOn_PredicateAND)
 
@@ -36,6 +38,9 @@ bool UFlowNodeAddOn_PredicateAND::EvaluatePredicate_Implementation() const
 
 bool UFlowNodeAddOn_PredicateAND::EvaluatePredicateAND(const TArray<UFlowNodeAddOn*>& AddOns)
 {
+	// predicates often read the same upstream data pins
+	const FFlowDataPinResolveCacheScope DataPinResolveCache(GetDefault<UFlowSettings>()->bCacheDataPinValuesWhileEvaluating);
+
 	for (int Index = 0; Index < AddOns.Num(); ++Index)
 	{
 		const UFlowNodeAddOn* AddOn = AddOns[Index];
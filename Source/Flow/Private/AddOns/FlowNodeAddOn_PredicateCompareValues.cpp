@@ -84,6 +84,26 @@ bool UFlowNodeAddOn_PredicateCompareValues::TryFindPropertyByPinName(const FName
 	return false;
 }
 
+bool UFlowNodeAddOn_PredicateCompareValues::TryFindPropertyViewByPinName(const FName& PinName, const FProperty*& OutFoundProperty, const FFlowDataPinValue*& OutFoundValue) const
+{
+	// Mirrors TryFindPropertyByPinName above
+	if (GetAuthoredValueName(LeftValue) == PinName)
+	{
+		OutFoundValue = LeftValue.DataPinValue.GetPtr();
+
+		return OutFoundValue != nullptr;
+	}
+
+	if (GetAuthoredValueName(RightValue) == PinName)
+	{
+		OutFoundValue = RightValue.DataPinValue.GetPtr();
+
+		return OutFoundValue != nullptr;
+	}
+
+	return Super::TryFindPropertyViewByPinName(PinName, OutFoundProperty, OutFoundValue);
+}
+
 bool UFlowNodeAddOn_PredicateCompareValues::IsEqualityOp() const
 {
 	return EFlowPredicateCompareOperatorType_Classifiers::IsEqualityOperation(OperatorType);
@@ -1,6 +1,8 @@
 // Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
 
 #include "AddOns/FlowNodeAddOn_PredicateOR.h"
+#include "FlowSettings.h"
+#include "Types/FlowDataPinResolveCache.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNodeAddOn_PredicateOR)
 
@@ -36,6 +38,9 @@ bool UFlowNodeAddOn_PredicateOR::EvaluatePredicate_Implementation() const
 
 bool UFlowNodeAddOn_PredicateOR::EvaluatePredicateOR(const TArray<UFlowNodeAddOn*>& AddOns)
 {
+	// predicates often read the same upstream data pins
+	const FFlowDataPinResolveCacheScope DataPinResolveCache(GetDefault<UFlowSettings>()->bCacheDataPinValuesWhileEvaluating);
+
 	int32 FalseCount = 0;
 	for (int Index = 0; Index < AddOns.Num(); ++Index)
 	{
@@ -179,32 +179,31 @@ EFlowReconcilePropertiesResult UFlowAssetParams::ReconcilePropertiesWithStartNod
 
 EFlowReconcilePropertiesResult UFlowAssetParams::ReconcilePropertiesWithParentParams()
 {
-	const EFlowReconcilePropertiesResult CycleResult = CheckForParentCycle();
-	if (EFlowReconcilePropertiesResult_Classifiers::IsErrorResult(CycleResult))
+	TArray<UFlowAssetParams*, TInlineAllocator<8>> ParentChain;
+	const EFlowReconcilePropertiesResult ChainResult = GatherParentChain(ParentChain);
+	if (EFlowReconcilePropertiesResult_Classifiers::IsErrorResult(ChainResult))
 	{
-		return CycleResult;
+		return ChainResult;
 	}
 
-	if (ParentParams.AssetPtr.IsNull())
+	if (ParentChain.IsEmpty())
 	{
 		return EFlowReconcilePropertiesResult::NoChanges;
 	}
 
-	UFlowAssetParams* Parent = ParentParams.AssetPtr.LoadSynchronous();
-	if (!Parent)
+	// flatten from the root ancestor down, so every params asset is reconciled against the already flattened parent
+	for (int32 Index = ParentChain.Num() - 1; Index > 0; --Index)
 	{
-		UE_LOG(LogFlow, Warning, TEXT("Failed to load ParentParams: %s"), *ParentParams.AssetPtr.ToString());
-
-		return EFlowReconcilePropertiesResult::Error_UnloadableParent;
+		ParentChain[Index - 1]->ReconcilePropertiesWithParent(*ParentChain[Index]);
 	}
+	ReconcilePropertiesWithParent(*ParentChain[0]);
 
-	const EFlowReconcilePropertiesResult ParentResult = Parent->ReconcilePropertiesWithParentParams();
-	if (EFlowReconcilePropertiesResult_Classifiers::IsErrorResult(ParentResult))
-	{
-		return ParentResult;
-	}
+	return EFlowReconcilePropertiesResult::ParamsPropertiesUpdated;
+}
 
-	const TArray<FFlowNamedDataPinProperty>& ParentProps = Parent->Properties;
+void UFlowAssetParams::ReconcilePropertiesWithParent(const UFlowAssetParams& Parent)
+{
+	const TArray<FFlowNamedDataPinProperty>& ParentProps = Parent.Properties;
 	TArray<FFlowNamedDataPinProperty> NewProperties;
 
 	for (const FFlowNamedDataPinProperty& ParentProp : ParentProps)
@@ -276,8 +275,6 @@ EFlowReconcilePropertiesResult UFlowAssetParams::ReconcilePropertiesWithParentPa
 	Properties = NewProperties;
 
 	ModifyAndRebuildPropertiesMap();
-
-	return EFlowReconcilePropertiesResult::ParamsPropertiesUpdated;
 }
 
 void UFlowAssetParams::ConfigureFlowAssetParams(TSoftObjectPtr<UFlowAsset> OwnerAsset, TSoftObjectPtr<UFlowAssetParams> InParentParams, const TArray<FFlowNamedDataPinProperty>& InProperties)
@@ -315,25 +312,30 @@ bool UFlowAssetParams::CanEditFlowDataPinValueClassFilter(const FFlowDataPinValu
 
 EFlowReconcilePropertiesResult UFlowAssetParams::CheckForParentCycle() const
 {
-	TSet<TSoftObjectPtr<UFlowAssetParams>> Visited;
+	TArray<UFlowAssetParams*, TInlineAllocator<8>> ParentChain;
+	return GatherParentChain(ParentChain);
+}
+
+EFlowReconcilePropertiesResult UFlowAssetParams::GatherParentChain(TArray<UFlowAssetParams*, TInlineAllocator<8>>& OutParentChain) const
+{
 	TSoftObjectPtr<UFlowAssetParams> Current = ParentParams.AssetPtr;
 
 	while (!Current.IsNull())
 	{
-		if (Visited.Contains(Current))
-		{
-			UE_LOG(LogFlow, Error, TEXT("Cyclic inheritance detected at: %s"), *Current.ToString());
-			return EFlowReconcilePropertiesResult::Error_CyclicInheritance;
-		}
-
-		Visited.Add(Current);
-		const UFlowAssetParams* CurrentParams = Current.LoadSynchronous();
+		UFlowAssetParams* CurrentParams = Current.LoadSynchronous();
 		if (!CurrentParams)
 		{
 			UE_LOG(LogFlow, Warning, TEXT("Failed to load ParentParams: %s"), *Current.ToString());
 			return EFlowReconcilePropertiesResult::Error_UnloadableParent;
 		}
 
+		if (CurrentParams == this || OutParentChain.Contains(CurrentParams))
+		{
+			UE_LOG(LogFlow, Error, TEXT("Cyclic inheritance detected at: %s"), *Current.ToString());
+			return EFlowReconcilePropertiesResult::Error_CyclicInheritance;
+		}
+
+		OutParentChain.Add(CurrentParams);
 		Current = CurrentParams->ParentParams.AssetPtr;
 	}
 
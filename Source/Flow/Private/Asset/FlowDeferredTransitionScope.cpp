@@ -11,6 +11,12 @@ void FFlowDeferredTransitionScope::EnqueueDeferredTrigger(const FFlowDeferredTri
 	DeferredTriggers.Add(Entry);
 }
 
+void FFlowDeferredTransitionScope::ResetScope()
+{
+	DeferredTriggers.Reset();
+	bIsOpen = true;
+}
+
 bool FFlowDeferredTransitionScope::TryFlushDeferredTriggers(UFlowAsset& OwningFlowAsset)
 {
 	// Ensure the scope is closed before beginning flushing
@@ -22,7 +28,7 @@ bool FFlowDeferredTransitionScope::TryFlushDeferredTriggers(UFlowAsset& OwningFl
 		const FFlowDeferredTriggerInput Entry = DeferredTriggers[0];
 		DeferredTriggers.RemoveAt(0, 1, EAllowShrinking::No);
 
-		OwningFlowAsset.TriggerInput(Entry.NodeGuid, Entry.PinName, Entry.FromPin);
+		OwningFlowAsset.TriggerInputByIndex(Entry);
 	}
 
 	check(DeferredTriggers.IsEmpty() || FFlowExecutionGate::IsHalted());
@@ -0,0 +1,162 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Asset/FlowExecutionPlan.h"
+#include "FlowAsset.h"
+#include "Nodes/FlowNode.h"
+
+TSharedRef<const FFlowExecutionPlan> FFlowExecutionPlan::Build(const UFlowAsset& TemplateAsset)
+{
+	TSharedRef<FFlowExecutionPlan> Plan = MakeShared<FFlowExecutionPlan>();
+
+	const TMap<FGuid, UFlowNode*>& Nodes = TemplateAsset.GetNodes();
+	Plan->PlanNodes.Reserve(Nodes.Num());
+	Plan->NodeIndexByGuid.Reserve(Nodes.Num());
+
+	// assign dense indices first, so connections can be resolved to any node
+	for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
+	{
+		if (IsValid(Node.Value))
+		{
+			const int32 NodeIndex = Plan->PlanNodes.AddDefaulted();
+			Plan->PlanNodes[NodeIndex].NodeGuid = Node.Key;
+			Plan->NodeIndexByGuid.Add(Node.Key, NodeIndex);
+		}
+	}
+
+	for (FFlowExecutionPlanNode& PlanNode : Plan->PlanNodes)
+	{
+		const UFlowNode* FlowNode = Nodes.FindRef(PlanNode.NodeGuid);
+		const TArray<FFlowPin>& OutputPins = FlowNode->GetOutputPins();
+
+		PlanNode.FirstOutput = Plan->Outputs.Num();
+		PlanNode.NumOutputs = OutputPins.Num();
+
+		for (const FFlowPin& OutputPin : OutputPins)
+		{
+			FFlowExecutionPlanOutput& Output = Plan->Outputs.AddDefaulted_GetRef();
+			Output.PinName = OutputPin.PinName;
+			Output.FirstTarget = Plan->Targets.Num();
+
+			// Connections cache only a single connection per exec output, due to schema rules
+			const FConnectedPin Connection = FlowNode->GetConnection(OutputPin.PinName);
+			if (OutputPin.IsExecPin() && Connection.NodeGuid.IsValid())
+			{
+				if (const int32* TargetIndex = Plan->NodeIndexByGuid.Find(Connection.NodeGuid))
+				{
+					Plan->Targets.Add({*TargetIndex, Connection.PinName});
+				}
+			}
+
+			Output.NumTargets = Plan->Targets.Num() - Output.FirstTarget;
+		}
+	}
+
+	// reverse index covers all cached connections (exec outputs and data inputs), including ones to nodes missing from the plan
+	for (const FFlowExecutionPlanNode& PlanNode : Plan->PlanNodes)
+	{
+		const UFlowNode* FlowNode = Nodes.FindRef(PlanNode.NodeGuid);
+		for (const TPair<FName, FConnectedPin>& Connection : FlowNode->GetConnections())
+		{
+			Plan->IncomingConnections.FindOrAdd(Connection.Value).Emplace(PlanNode.NodeGuid, Connection.Key);
+		}
+	}
+
+	Plan->Outputs.Shrink();
+	Plan->Targets.Shrink();
+
+	Plan->BuildExecutionOrder(TemplateAsset);
+
+	return Plan;
+}
+
+void FFlowExecutionPlan::BuildExecutionOrder(const UFlowAsset& TemplateAsset)
+{
+	const UFlowNode* EntryNode = TemplateAsset.GetDefaultEntryNode();
+	const int32 EntryIndex = EntryNode ? FindNodeIndex(EntryNode->GetGuid()) : INDEX_NONE;
+	if (EntryIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const TMap<FGuid, UFlowNode*>& Nodes = TemplateAsset.GetNodes();
+
+	// depth-first walk with explicit stack, matching the recursion of UFlowAsset::GetNodesInExecutionOrder_Recursive
+	struct FVisit
+	{
+		TArray<int32, TInlineAllocator<8>> ConnectedNodes;
+		int32 NextConnection = 0;
+	};
+
+	TBitArray<> VisitedNodes(false, PlanNodes.Num());
+	TArray<FVisit> Stack;
+
+	const auto Visit = [&](const int32 NodeIndex)
+	{
+		VisitedNodes[NodeIndex] = true;
+		ExecutionOrder.Add(NodeIndex);
+
+		// same order as UFlowNode::GatherConnectedNodes, each node once
+		FVisit& NewVisit = Stack.AddDefaulted_GetRef();
+		const UFlowNode* FlowNode = Nodes.FindRef(PlanNodes[NodeIndex].NodeGuid);
+		for (const TPair<FName, FConnectedPin>& Connection : FlowNode->GetConnections())
+		{
+			if (const int32* ConnectedIndex = NodeIndexByGuid.Find(Connection.Value.NodeGuid))
+			{
+				NewVisit.ConnectedNodes.AddUnique(*ConnectedIndex);
+			}
+		}
+	};
+
+	Visit(EntryIndex);
+	while (Stack.Num() > 0)
+	{
+		FVisit& CurrentVisit = Stack.Last();
+		if (CurrentVisit.NextConnection < CurrentVisit.ConnectedNodes.Num())
+		{
+			const int32 ConnectedIndex = CurrentVisit.ConnectedNodes[CurrentVisit.NextConnection++];
+			if (!VisitedNodes[ConnectedIndex])
+			{
+				Visit(ConnectedIndex);
+			}
+		}
+		else
+		{
+			Stack.Pop(EAllowShrinking::No);
+		}
+	}
+
+	ExecutionOrder.Shrink();
+}
+
+int32 FFlowExecutionPlan::FindNodeIndex(const FGuid& NodeGuid) const
+{
+	const int32* NodeIndex = NodeIndexByGuid.Find(NodeGuid);
+	return NodeIndex ? *NodeIndex : INDEX_NONE;
+}
+
+const FFlowExecutionPlanOutput* FFlowExecutionPlan::FindOutput(const int32 NodeIndex, const int32 OutputPinIndex, const FName& PinName) const
+{
+	if (!PlanNodes.IsValidIndex(NodeIndex))
+	{
+		return nullptr;
+	}
+
+	const FFlowExecutionPlanNode& PlanNode = PlanNodes[NodeIndex];
+	if (OutputPinIndex < 0 || OutputPinIndex >= PlanNode.NumOutputs)
+	{
+		return nullptr;
+	}
+
+	const FFlowExecutionPlanOutput& Output = Outputs[PlanNode.FirstOutput + OutputPinIndex];
+	return Output.PinName == PinName ? &Output : nullptr;
+}
+
+TConstArrayView<FConnectedPin> FFlowExecutionPlan::GetIncomingConnections(const FConnectedPin& ToPin) const
+{
+	if (const TArray<FConnectedPin>* Connections = IncomingConnections.Find(ToPin))
+	{
+		return *Connections;
+	}
+
+	return TConstArrayView<FConnectedPin>();
+}
@@ -20,8 +20,6 @@
 #include "Types/FlowStructUtils.h"
 
 #include "Engine/World.h"
-#include "Serialization/MemoryReader.h"
-#include "Serialization/MemoryWriter.h"
 #include "Algo/AnyOf.h"
 
 #if WITH_EDITOR
@@ -29,6 +27,7 @@
 #include "AssetToolsModule.h"
 #include "ContentBrowserModule.h"
 #include "IContentBrowserSingleton.h"
+#include "Misc/TransactionObjectEvent.h"
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
 #include "Modules/ModuleManager.h"
@@ -84,6 +83,24 @@ void UFlowAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEv
 	}
 }
 
+void UFlowAsset::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// nodes restored by undo/redo might be registered or connected differently than the compiled plan says
+	InvalidateExecutionPlan();
+}
+
+void UFlowAsset::PostTransacted(const FTransactionObjectEvent& TransactionEvent)
+{
+	Super::PostTransacted(TransactionEvent);
+
+	if (TransactionEvent.GetEventType() == ETransactionObjectEventType::UndoRedo)
+	{
+		InvalidateExecutionPlan();
+	}
+}
+
 void UFlowAsset::PostDuplicate(bool bDuplicateForPIE)
 {
 	Super::PostDuplicate(bDuplicateForPIE);
@@ -378,6 +395,7 @@ void UFlowAsset::RegisterNode(const FGuid& NewGuid, UFlowNode* NewNode)
 {
 	NewNode->SetGuid(NewGuid);
 	Nodes.Emplace(NewGuid, NewNode);
+	InvalidateExecutionPlan();
 
 	HarvestNodeConnections();
 
@@ -391,6 +409,7 @@ void UFlowAsset::UnregisterNode(const FGuid& NodeGuid)
 {
 	Nodes.Remove(NodeGuid);
 	Nodes.Compact();
+	InvalidateExecutionPlan();
 
 	HarvestNodeConnections();
 
@@ -495,6 +514,9 @@ void UFlowAsset::HarvestNodeConnections(UFlowNode* TargetNode)
 
 			FlowNode->SetConnections(FoundConnections);
 			FlowNode->PostEditChange();
+
+			// compile the execution plan again with new connections
+			InvalidateExecutionPlan();
 		}
 	}
 }
@@ -737,15 +759,16 @@ TArray<FConnectedPin> UFlowAsset::GatherPinsConnectedToPin(const FConnectedPin&
 	TArray<FConnectedPin> ConnectedPins;
 
 	// Connections are only stored on one of the Nodes they connect depending on pin type.
-	// As such, we need to iterate all Nodes to find all possible Connections for the Pin.
-	for (const auto& GuidNodePair : Nodes)
+	// The Pin's own node knows its outgoing connection, the reverse index knows connections stored by other nodes.
+	const UFlowNode* PinNode = Nodes.FindRef(Pin.NodeGuid);
+	if (IsValid(PinNode))
 	{
-		if (IsValid(GuidNodePair.Value))
-		{
-			ConnectedPins.Append(GuidNodePair.Value->GetKnownConnectionsToPin(Pin));
-		}
+		ConnectedPins.Append(PinNode->GetKnownConnectionsToPin(Pin));
 	}
 
+	const TSharedRef<const FFlowExecutionPlan> Plan = GetOrBuildExecutionPlan();
+	ConnectedPins.Append(Plan->GetIncomingConnections(Pin));
+
 	return ConnectedPins;
 }
 
@@ -958,20 +981,77 @@ void UFlowAsset::InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlow
 	// Initialize any customizable Policies before we instantiate nodes
 	InitializePreloadPolicy();
 
+	ExecutionPlan = InTemplateAsset.GetOrBuildExecutionPlan();
+	NodesByPlanIndex.SetNumZeroed(ExecutionPlan->GetNumNodes());
+
+	InstantiateNodes();
+
 	for (TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Nodes)
 	{
-		UFlowNode* NewNodeInstance = NewObject<UFlowNode>(this, Node.Value->GetClass(), NAME_None, RF_Transient, Node.Value, false, nullptr);
-		Node.Value = NewNodeInstance;
+		UFlowNode* NodeInstance = Node.Value;
 
-		if (UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(NewNodeInstance))
+		NodeInstance->PlanNodeIndex = ExecutionPlan->FindNodeIndex(Node.Key);
+		if (NodeInstance->PlanNodeIndex != INDEX_NONE)
+		{
+			NodesByPlanIndex[NodeInstance->PlanNodeIndex] = NodeInstance;
+		}
+
+		if (UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(NodeInstance))
 		{
 			if (!CustomInput->EventName.IsNone())
 			{
 				CustomInputNodes.Emplace(CustomInput);
+				CustomInputNodesByEventName.FindOrAdd(CustomInput->EventName).AddUnique(CustomInput);
+			}
+		}
+
+		NodeInstance->InitializeInstance();
+	}
+
+	PreloadLookahead.Initialize(*this, GetPreloadPolicy());
+}
+
+void UFlowAsset::InstantiateNodes()
+{
+	for (TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Nodes)
+	{
+		UFlowNode* TemplateNode = Node.Value;
+
+		// nodes of recycled instance are owned by this asset already
+		if (Node.Value->GetOuter() == this)
+		{
+			// pooled instance doesn't reference template nodes, find them again
+			TemplateNode = TemplateAsset ? TemplateAsset->Nodes.FindRef(Node.Key) : nullptr;
+			if (TemplateNode == nullptr || Node.Value->CanBeReusedByInstancePool())
+			{
+				Node.Value->TemplateNode = TemplateNode;
+				continue;
 			}
+
+			// otherwise node might keep runtime state of the previous run, replace it with a fresh instance
 		}
 
-		NewNodeInstance->InitializeInstance();
+		UFlowNode* NewNodeInstance = NewObject<UFlowNode>(this, TemplateNode->GetClass(), NAME_None, RF_Transient, TemplateNode, false, nullptr);
+
+		// Connections and data pin property sources are read from the template node, so instance doesn't need its own copy
+		// both are private, subclasses read them through accessors returning the template's data
+		NewNodeInstance->TemplateNode = TemplateNode;
+		NewNodeInstance->Connections.Empty();
+		NewNodeInstance->MapDataPinNameToPropertySource.Empty();
+
+		Node.Value = NewNodeInstance;
+	}
+}
+
+void UFlowAsset::OnAddedToInstancePool()
+{
+	// pooled instance shouldn't keep its template loaded, InstantiateNodes() finds template nodes again
+	for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
+	{
+		if (Node.Value && Node.Value->GetOuter() == this)
+		{
+			Node.Value->TemplateNode = nullptr;
+		}
 	}
 }
 
@@ -990,6 +1070,21 @@ void UFlowAsset::DeinitializeInstance()
 			}
 		}
 
+		PreloadLookahead.Reset();
+		NodesByPlanIndex.Empty();
+
+		bSaveDirty = true;
+		CachedNodeRecords.Empty();
+		CachedNodeRecordsFormatId.Invalidate();
+		bCachedNodeRecordsReusable = false;
+		CachedSavedSubGraphs.Empty();
+
+		ExecutionPlan.Reset();
+		CustomInputNodes.Reset();
+		CustomInputNodesByEventName.Reset();
+
+		UFlowAsset* FinishedTemplate = TemplateAsset;
+
 		const int32 ActiveInstancesLeft = TemplateAsset->RemoveInstance(this);
 		if (ActiveInstancesLeft == 0 && GetFlowSubsystem())
 		{
@@ -997,7 +1092,22 @@ void UFlowAsset::DeinitializeInstance()
 		}
 
 		TemplateAsset = nullptr;
+
+		if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		{
+			FlowSubsystem->ReleaseInstanceToPool(*FinishedTemplate, *this);
+		}
+	}
+}
+
+TSharedRef<const FFlowExecutionPlan> UFlowAsset::GetOrBuildExecutionPlan() const
+{
+	if (!ExecutionPlan.IsValid())
+	{
+		ExecutionPlan = FFlowExecutionPlan::Build(*this);
 	}
+
+	return ExecutionPlan.ToSharedRef();
 }
 
 AActor* UFlowAsset::TryFindActorOwner() const
@@ -1049,7 +1159,7 @@ void UFlowAsset::StartFlow(IFlowDataPinValueSupplierInterface* DataPinValueSuppl
 
 	if (UFlowNode* ConnectedEntryNode = GetDefaultEntryNode())
 	{
-		RecordedNodes.Add(ConnectedEntryNode);
+		AddRecordedNode(ConnectedEntryNode);
 
 		if (IFlowNodeWithExternalDataPinSupplierInterface* ExternalPinSuppliedNode = Cast<IFlowNodeWithExternalDataPinSupplierInterface>(ConnectedEntryNode))
 		{
@@ -1067,10 +1177,8 @@ bool UFlowAsset::HasStartedFlow() const
 
 void UFlowAsset::FinishNode(UFlowNode* Node)
 {
-	if (ActiveNodes.Contains(Node))
+	if (RemoveActiveNode(Node))
 	{
-		ActiveNodes.Remove(Node);
-
 		// if graph reached Finish and this asset instance was created by SubGraph node
 		if (Node->CanFinishGraph())
 		{
@@ -1084,8 +1192,7 @@ void UFlowAsset::FinishNode(UFlowNode* Node)
 			// if this instance is a Root Flow, we need to deregister it from the subsystem first
 			if (Owner.IsValid())
 			{
-				const TSet<UFlowAsset*>& RootFlowInstances = GetFlowSubsystem()->GetRootInstancesByOwner(Owner.Get());
-				if (RootFlowInstances.Contains(this))
+				if (GetFlowSubsystem()->IsRootInstance(this))
 				{
 					GetFlowSubsystem()->FinishRootFlow(Owner.Get(), TemplateAsset, EFlowFinishPolicy::Keep);
 
@@ -1108,6 +1215,51 @@ void UFlowAsset::ResetNodes()
 	RecordedNodes.Empty();
 }
 
+bool UFlowAsset::AddActiveNode(UFlowNode* Node)
+{
+	if (Node->ActiveNodeIndex != INDEX_NONE)
+	{
+		return false;
+	}
+
+	Node->ActiveNodeIndex = ActiveNodes.Add(Node);
+	MarkSaveDirty();
+	UpdatePreloadLookahead();
+
+	return true;
+}
+
+bool UFlowAsset::RemoveActiveNode(UFlowNode* Node)
+{
+	const int32 Index = Node->ActiveNodeIndex;
+	if (Index == INDEX_NONE || !ensure(ActiveNodes.IsValidIndex(Index) && ActiveNodes[Index] == Node))
+	{
+		return false;
+	}
+
+	// preserving activation order, only nodes activated after this one shift
+	ActiveNodes.RemoveAt(Index, 1, EAllowShrinking::No);
+	Node->ActiveNodeIndex = INDEX_NONE;
+
+	for (int32 i = Index; i < ActiveNodes.Num(); i++)
+	{
+		ActiveNodes[i]->ActiveNodeIndex = i;
+	}
+
+	MarkSaveDirty();
+	UpdatePreloadLookahead();
+	return true;
+}
+
+void UFlowAsset::AddRecordedNode(UFlowNode* Node)
+{
+	if (!Node->bRecordedByAsset)
+	{
+		Node->bRecordedByAsset = true;
+		RecordedNodes.Add(Node);
+	}
+}
+
 void UFlowAsset::FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool bRemoveInstance /*= true*/)
 {
 	FinishPolicy = InFinishPolicy;
@@ -1117,6 +1269,8 @@ void UFlowAsset::FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool b
 	// end execution of this asset and all of its nodes
 	for (UFlowNode* Node : ActiveNodes)
 	{
+		// node is no longer tracked, so finishing it during deactivation won't modify the array we iterate
+		Node->ActiveNodeIndex = INDEX_NONE;
 		Node->Deactivate();
 	}
 	ActiveNodes.Empty();
@@ -1168,6 +1322,14 @@ void UFlowAsset::InitializePreloadPolicy()
 	ensureAlwaysMsgf(PreloadPolicy.IsValid(), TEXT("There's no valid Preload Policy set in the project!"));
 }
 
+void UFlowAsset::UpdatePreloadLookahead()
+{
+	if (PreloadLookahead.IsEnabled())
+	{
+		PreloadLookahead.Update(*this);
+	}
+}
+
 const FFlowPreloadPolicy& UFlowAsset::GetPreloadPolicy() const
 {
 	checkf(PreloadPolicy.IsValid(), TEXT("PreloadPolicy must be initialized prior to calling GetPreloadPolicy()"));
@@ -1176,23 +1338,50 @@ const FFlowPreloadPolicy& UFlowAsset::GetPreloadPolicy() const
 
 void UFlowAsset::TriggerCustomInput(const FName& EventName, IFlowDataPinValueSupplierInterface* DataPinValueSupplier)
 {
-	for (UFlowNode_CustomInput* CustomInputNode : CustomInputNodes)
+	ExecuteCustomInputNodes(EventName, DataPinValueSupplier);
+}
+
+void UFlowAsset::TriggerCustomInputs(TConstArrayView<FName> EventNames, IFlowDataPinValueSupplierInterface* DataPinValueSupplier)
+{
+	// a single scope for the whole batch, instead of pushing and flushing a scope for every event
+	const bool bOpenBatchScope = ShouldDeferTriggers() && !FFlowExecutionGate::IsHalted()
+		&& (DeferredTransitionScopes.IsEmpty() || !DeferredTransitionScopes.Top()->IsOpen());
+
+	const TSharedPtr<FFlowDeferredTransitionScope> BatchScope = bOpenBatchScope ? PushDeferredTransitionScope() : nullptr;
+
+	for (const FName& EventName : EventNames)
 	{
-		if (CustomInputNode->EventName == EventName)
-		{
-			RecordedNodes.Add(CustomInputNode);
+		ExecuteCustomInputNodes(EventName, DataPinValueSupplier);
+	}
 
-			// NOTE (gtaylor) Custom Input nodes cannot currently add data pins (like Start or DefineProperties nodes can)
-			// but we may want to allow them to source parameters, so I am providing the subgraph node as the 
-			// IFlowDataPinValueSupplierInterface when triggering the node (even though it's not used at this time).
+	if (BatchScope.IsValid())
+	{
+		PopDeferredTransitionScope(BatchScope);
+	}
+}
 
-			if (IFlowNodeWithExternalDataPinSupplierInterface* ExternalPinSuppliedNode = Cast<IFlowNodeWithExternalDataPinSupplierInterface>(CustomInputNode))
-			{
-				ExternalPinSuppliedNode->SetDataPinValueSupplier(DataPinValueSupplier);
-			}
+void UFlowAsset::ExecuteCustomInputNodes(const FName& EventName, IFlowDataPinValueSupplierInterface* DataPinValueSupplier)
+{
+	const FlowArray::TInlineArray<UFlowNode_CustomInput*, 1>* CustomInputNodesForEvent = CustomInputNodesByEventName.Find(EventName);
+	if (CustomInputNodesForEvent == nullptr)
+	{
+		return;
+	}
+
+	for (UFlowNode_CustomInput* CustomInputNode : *CustomInputNodesForEvent)
+	{
+		AddRecordedNode(CustomInputNode);
 
-			CustomInputNode->ExecuteInput(EventName);
+		// NOTE (gtaylor) Custom Input nodes cannot currently add data pins (like Start or DefineProperties nodes can)
+		// but we may want to allow them to source parameters, so I am providing the subgraph node as the 
+		// IFlowDataPinValueSupplierInterface when triggering the node (even though it's not used at this time).
+
+		if (IFlowNodeWithExternalDataPinSupplierInterface* ExternalPinSuppliedNode = Cast<IFlowNodeWithExternalDataPinSupplierInterface>(CustomInputNode))
+		{
+			ExternalPinSuppliedNode->SetDataPinValueSupplier(DataPinValueSupplier);
 		}
+
+		CustomInputNode->ExecuteInput(EventName);
 	}
 }
 
@@ -1227,43 +1416,75 @@ void UFlowAsset::TriggerCustomOutput(const FName& EventName)
 }
 
 void UFlowAsset::TriggerInput(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin)
+{
+	// entry point for callers outside of the execution plan, node index needs to be resolved once
+	const int32 NodeIndex = ExecutionPlan.IsValid() ? ExecutionPlan->FindNodeIndex(NodeGuid) : INDEX_NONE;
+	TriggerInputByIndex(FFlowDeferredTriggerInput{NodeGuid, PinName, FromPin, NodeIndex});
+}
+
+void UFlowAsset::TriggerInputByIndex(const FFlowDeferredTriggerInput& Trigger)
 {
 	if (FFlowExecutionGate::IsHalted())
 	{
 		// Halt always takes precedence for debugger correctness
-		EnqueueDeferredTrigger(NodeGuid, PinName, FromPin);
+		EnqueueDeferredTrigger(Trigger);
 	}
 	else if (ShouldDeferTriggers())
 	{
 		// Defer only if we have an open the top scope
 		if (!DeferredTransitionScopes.IsEmpty() && DeferredTransitionScopes.Top()->IsOpen())
 		{
-			EnqueueDeferredTrigger(NodeGuid, PinName, FromPin);
+			EnqueueDeferredTrigger(Trigger);
 		}
 		else
 		{
 			const TSharedPtr<FFlowDeferredTransitionScope> CurrentScope = PushDeferredTransitionScope();
-			TriggerInputDirect(NodeGuid, PinName, FromPin);
+			TriggerInputDirect(Trigger);
 			PopDeferredTransitionScope(CurrentScope);
 		}
 	}
 	else
 	{
-		TriggerInputDirect(NodeGuid, PinName, FromPin);
+		TriggerInputDirect(Trigger);
+	}
+}
+
+void UFlowAsset::TriggerConnectedInputs(const UFlowNode& FromNode, const int32 OutputPinIndex, const FName& PinName)
+{
+	const FConnectedPin FromPin(FromNode.GetGuid(), PinName);
+
+	if (ExecutionPlan.IsValid())
+	{
+		if (const FFlowExecutionPlanOutput* Output = ExecutionPlan->FindOutput(FromNode.PlanNodeIndex, OutputPinIndex, PinName))
+		{
+			for (const FFlowExecutionPlanTarget& Target : ExecutionPlan->GetTargets(*Output))
+			{
+				TriggerInputByIndex(FFlowDeferredTriggerInput{ExecutionPlan->GetNodeGuid(Target.NodeIndex), Target.PinName, FromPin, Target.NodeIndex});
+			}
+
+			return;
+		}
+	}
+
+	// fallback for pins unknown to the plan, i.e. node instance changed its pins after the plan has been built
+	FConnectedPin Connection;
+	if (FromNode.FindConnectedNodeForPinCached(PinName, Connection))
+	{
+		TriggerInput(Connection.NodeGuid, Connection.PinName, FromPin);
 	}
 }
 
-void UFlowAsset::TriggerInputDirect(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin)
+void UFlowAsset::TriggerInputDirect(const FFlowDeferredTriggerInput& Trigger)
 {
-	if (UFlowNode* Node = Nodes.FindRef(NodeGuid))
+	UFlowNode* Node = NodesByPlanIndex.IsValidIndex(Trigger.NodeIndex) ? NodesByPlanIndex[Trigger.NodeIndex].Get() : Nodes.FindRef(Trigger.NodeGuid);
+	if (Node)
 	{
-		if (!ActiveNodes.Contains(Node))
+		if (AddActiveNode(Node))
 		{
-			ActiveNodes.Add(Node);
-			RecordedNodes.Add(Node);
+			AddRecordedNode(Node);
 		}
 
-		Node->TriggerInput(PinName);
+		Node->TriggerInput(Trigger.PinName);
 	}
 }
 
@@ -1272,7 +1493,7 @@ bool UFlowAsset::ShouldDeferTriggers() const
 	return GetDefault<UFlowSettings>()->bDeferTriggeredOutputsWhileTriggering;
 }
 
-void UFlowAsset::EnqueueDeferredTrigger(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin)
+void UFlowAsset::EnqueueDeferredTrigger(const FFlowDeferredTriggerInput& Trigger)
 {
 	if (DeferredTransitionScopes.IsEmpty() || !DeferredTransitionScopes.Top()->IsOpen())
 	{
@@ -1282,7 +1503,7 @@ void UFlowAsset::EnqueueDeferredTrigger(const FGuid& NodeGuid, const FName& PinN
 	}
 
 	// Always enqueue to the current innermost (top) scope
-	DeferredTransitionScopes.Top()->EnqueueDeferredTrigger(FFlowDeferredTriggerInput{NodeGuid, PinName, FromPin});
+	DeferredTransitionScopes.Top()->EnqueueDeferredTrigger(Trigger);
 }
 
 TSharedPtr<FFlowDeferredTransitionScope> UFlowAsset::PushDeferredTransitionScope()
@@ -1294,7 +1515,12 @@ TSharedPtr<FFlowDeferredTransitionScope> UFlowAsset::PushDeferredTransitionScope
 		FormerTop->CloseScope();
 	}
 
-	// Push a fresh open scope
+	// Push an open scope, reusing a flushed one if possible
+	if (!DeferredTransitionScopePool.IsEmpty())
+	{
+		return DeferredTransitionScopes.Add_GetRef(DeferredTransitionScopePool.Pop(EAllowShrinking::No));
+	}
+
 	return DeferredTransitionScopes.Add_GetRef(MakeShared<FFlowDeferredTransitionScope>());
 }
 
@@ -1308,7 +1534,18 @@ bool UFlowAsset::TryFlushAndRemoveDeferredTransitionScope(const TSharedPtr<FFlow
 	if (ScopeToFlush->TryFlushDeferredTriggers(*this))
 	{
 		// Remove the exact instance we were holding (handles nested push/pop cases)
-		DeferredTransitionScopes.RemoveSingle(ScopeToFlush);
+		const int32 ScopeIndex = DeferredTransitionScopes.Find(ScopeToFlush);
+		if (ScopeIndex != INDEX_NONE)
+		{
+			DeferredTransitionScopes.RemoveAt(ScopeIndex, 1, EAllowShrinking::No);
+
+			// Recycle the scope only if the caller holds the last reference, nobody else can be still flushing it
+			if (ScopeToFlush.GetSharedReferenceCount() == 1)
+			{
+				ScopeToFlush->ResetScope();
+				DeferredTransitionScopePool.Add(ScopeToFlush);
+			}
+		}
 		return true;
 	}
 	else
@@ -1414,35 +1651,83 @@ FFlowAssetSaveData UFlowAsset::SaveInstance(TArray<FFlowAssetSaveData>& SavedFlo
 	// opportunity to collect data before serializing asset
 	OnSave();
 
-	// iterate nodes
-	TArray<UFlowNode*> NodesInExecutionOrder;
-	GetNodesInExecutionOrder<UFlowNode>(GetDefaultEntryNode(), NodesInExecutionOrder);
-	for (UFlowNode* Node : NodesInExecutionOrder)
+	const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	FFlowSaveNameTable* NameTable = FlowSubsystem ? FlowSubsystem->GetActiveSaveNameTable() : nullptr;
+
+	if (!bSaveDirty && bCachedNodeRecordsReusable && CachedNodeRecordsFormatId == FlowSave::GetFormatId(NameTable))
 	{
-		if (Node && Node->ShouldSave())
+		// nothing changed since the previous save, only SubGraph instances might have changed
+		for (const TWeakObjectPtr<UFlowNode_SubGraph>& SubGraphNode : CachedSavedSubGraphs)
 		{
-			// iterate SubGraphs
-			if (UFlowNode_SubGraph* SubGraphNode = Cast<UFlowNode_SubGraph>(Node))
+			if (SubGraphNode.IsValid())
 			{
-				const TWeakObjectPtr<UFlowAsset> SubFlowInstance = GetFlowInstance(SubGraphNode);
-				if (SubFlowInstance.IsValid())
+				SaveSubFlowInstance(*SubGraphNode.Get(), SavedFlowInstances);
+
+				// SubGraph updated its instance name
+				if (!SubGraphNode->CanReuseSaveData(NameTable))
 				{
-					const FFlowAssetSaveData SubAssetRecord = SubFlowInstance->SaveInstance(SavedFlowInstances);
-					SubGraphNode->SavedAssetInstanceName = SubAssetRecord.InstanceName;
+					const FGuid& SubGraphGuid = SubGraphNode->GetGuid();
+					if (FFlowNodeSaveData* NodeRecord = CachedNodeRecords.FindByPredicate([&SubGraphGuid](const FFlowNodeSaveData& Record) { return Record.NodeGuid == SubGraphGuid; }))
+					{
+						SubGraphNode->SaveInstance(*NodeRecord);
+					}
 				}
 			}
+		}
 
-			FFlowNodeSaveData NodeRecord;
-			Node->SaveInstance(NodeRecord);
+		bSaveDirty = false;
+		AssetRecord.NodeRecords = CachedNodeRecords;
+	}
+	else
+	{
+		CachedSavedSubGraphs.Reset();
+		bCachedNodeRecordsReusable = true;
 
-			AssetRecord.NodeRecords.Emplace(NodeRecord);
+		// iterate nodes, the execution order is computed once per template and shared by its instances
+		TArray<UFlowNode*> NodesInExecutionOrder;
+		if (ExecutionPlan.IsValid())
+		{
+			const TConstArrayView<int32> ExecutionOrder = ExecutionPlan->GetExecutionOrder();
+			NodesInExecutionOrder.Reserve(ExecutionOrder.Num());
+			for (const int32 NodeIndex : ExecutionOrder)
+			{
+				NodesInExecutionOrder.Emplace(NodesByPlanIndex[NodeIndex].Get());
+			}
+		}
+		else
+		{
+			GetNodesInExecutionOrder<UFlowNode>(GetDefaultEntryNode(), NodesInExecutionOrder);
 		}
+
+		for (UFlowNode* Node : NodesInExecutionOrder)
+		{
+			if (Node && Node->ShouldSave())
+			{
+				// iterate SubGraphs
+				if (UFlowNode_SubGraph* SubGraphNode = Cast<UFlowNode_SubGraph>(Node))
+				{
+					SaveSubFlowInstance(*SubGraphNode, SavedFlowInstances);
+					CachedSavedSubGraphs.Emplace(SubGraphNode);
+				}
+
+				FFlowNodeSaveData NodeRecord;
+				Node->SaveInstance(NodeRecord);
+
+				AssetRecord.NodeRecords.Emplace(NodeRecord);
+
+				// node data has been cached only if node supports it
+				bCachedNodeRecordsReusable &= Node->CanReuseSaveData(NameTable);
+			}
+		}
+
+		// nodes mark the asset dirty while saving, i.e. SubGraph updating its instance name
+		bSaveDirty = false;
+		CachedNodeRecords = AssetRecord.NodeRecords;
+		CachedNodeRecordsFormatId = FlowSave::GetFormatId(NameTable);
 	}
 
 	// serialize asset
-	FMemoryWriter MemoryWriter(AssetRecord.AssetData, true);
-	FFlowArchive Ar(MemoryWriter);
-	Serialize(Ar);
+	FlowSave::WriteObject(*this, AssetRecord.AssetData, NameTable);
 
 	// write archive to SaveGame
 	SavedFlowInstances.Emplace(AssetRecord);
@@ -1450,13 +1735,31 @@ FFlowAssetSaveData UFlowAsset::SaveInstance(TArray<FFlowAssetSaveData>& SavedFlo
 	return AssetRecord;
 }
 
+void UFlowAsset::SaveSubFlowInstance(UFlowNode_SubGraph& SubGraphNode, TArray<FFlowAssetSaveData>& SavedFlowInstances)
+{
+	const TWeakObjectPtr<UFlowAsset> SubFlowInstance = GetFlowInstance(&SubGraphNode);
+	if (SubFlowInstance.IsValid())
+	{
+		const FFlowAssetSaveData SubAssetRecord = SubFlowInstance->SaveInstance(SavedFlowInstances);
+		if (SubGraphNode.SavedAssetInstanceName != SubAssetRecord.InstanceName)
+		{
+			SubGraphNode.SavedAssetInstanceName = SubAssetRecord.InstanceName;
+			SubGraphNode.MarkSaveDirty();
+		}
+	}
+}
+
 void UFlowAsset::LoadInstance(const FFlowAssetSaveData& AssetRecord)
 {
-	FMemoryReader MemoryReader(AssetRecord.AssetData, true);
-	FFlowArchive Ar(MemoryReader);
-	Serialize(Ar);
+	const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (!FlowSave::ReadObject(*this, AssetRecord.AssetData, FlowSubsystem ? FlowSubsystem->GetLoadedSaveNameTable() : nullptr))
+	{
+		UE_LOG(LogFlow, Error, TEXT("Failed to read data of Flow Asset instance %s from SaveGame"), *AssetRecord.InstanceName);
+		return;
+	}
 
 	PreStartFlow();
+	MarkSaveDirty();
 
 	// iterate graph "from the end", backward to execution order
 	// prevents issue when the preceding node would instantly fire output to a not-yet-loaded node
@@ -1475,12 +1778,12 @@ void UFlowAsset::OnActivationStateLoaded(UFlowNode* Node)
 {
 	if (Node->ActivationState != EFlowNodeState::NeverActivated)
 	{
-		RecordedNodes.Emplace(Node);
+		AddRecordedNode(Node);
 	}
 
 	if (Node->ActivationState == EFlowNodeState::Active)
 	{
-		ActiveNodes.Emplace(Node);
+		AddActiveNode(Node);
 	}
 }
 
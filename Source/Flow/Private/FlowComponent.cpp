@@ -14,8 +14,6 @@
 #include "Engine/World.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
-#include "Serialization/MemoryReader.h"
-#include "Serialization/MemoryWriter.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowComponent)
 
@@ -412,9 +410,16 @@ void UFlowComponent::NotifyActor(const FGameplayTag ActorTag, const FGameplayTag
 	{
 		if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(ActorTag))
+			// notified components might modify the registry, so iterate a copy kept on the stack
+			TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> Components;
+			FlowSubsystem->GatherComponents(ActorTag, true, Components);
+
+			for (const TWeakObjectPtr<UFlowComponent>& Component : Components)
 			{
-				Component->ReceiveNotify.Broadcast(this, NotifyTag);
+				if (Component.IsValid())
+				{
+					Component->ReceiveNotify.Broadcast(this, NotifyTag);
+				}
 			}
 		}
 
@@ -433,11 +438,18 @@ void UFlowComponent::OnRep_NotifyTagsFromAnotherComponent()
 {
 	if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 	{
+		TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> Components;
 		for (const FNotifyTagReplication& Notify : NotifyTagsFromAnotherComponent)
 		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(Notify.ActorTag))
+			Components.Reset();
+			FlowSubsystem->GatherComponents(Notify.ActorTag, true, Components);
+
+			for (const TWeakObjectPtr<UFlowComponent>& Component : Components)
 			{
-				Component->ReceiveNotify.Broadcast(this, Notify.NotifyTag);
+				if (Component.IsValid())
+				{
+					Component->ReceiveNotify.Broadcast(this, Notify.NotifyTag);
+				}
 			}
 		}
 	}
@@ -506,6 +518,21 @@ void UFlowComponent::TriggerRootFlowCustomInput(const FName& EventName) const
 	}
 }
 
+void UFlowComponent::TriggerRootFlowCustomInputs(const TArray<FName>& EventNames) const
+{
+	if (RootFlow && IsFlowNetMode(RootFlowMode))
+	{
+		if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		{
+			UFlowAsset* RootFlowInstance = FlowSubsystem->GetRootFlow(this);
+			if (IsValid(RootFlowInstance))
+			{
+				RootFlowInstance->TriggerCustomInputs(EventNames);
+			}
+		}
+	}
+}
+
 void UFlowComponent::DispatchRootFlowCustomEvent(UFlowAsset* RootFlowInstance, const FName& EventName)
 {
 	BP_OnRootFlowCustomEvent(RootFlowInstance, EventName);
@@ -517,11 +544,20 @@ void UFlowComponent::SaveRootFlow(TArray<FFlowAssetSaveData>& SavedFlowInstances
 	if (UFlowAsset* FlowAssetInstance = GetRootFlowInstance())
 	{
 		const FFlowAssetSaveData AssetRecord = FlowAssetInstance->SaveInstance(SavedFlowInstances);
-		SavedAssetInstanceName = AssetRecord.InstanceName;
+		SetSavedAssetInstanceName(AssetRecord.InstanceName);
 		return;
 	}
 
-	SavedAssetInstanceName = FString();
+	SetSavedAssetInstanceName(FString());
+}
+
+void UFlowComponent::SetSavedAssetInstanceName(const FString& InstanceName)
+{
+	if (SavedAssetInstanceName != InstanceName)
+	{
+		SavedAssetInstanceName = InstanceName;
+		MarkSaveDirty();
+	}
 }
 
 void UFlowComponent::LoadRootFlow()
@@ -531,7 +567,7 @@ void UFlowComponent::LoadRootFlow()
 		VerifyIdentityTags();
 
 		GetFlowSubsystem()->LoadRootFlow(this, RootFlow, SavedAssetInstanceName, bAllowMultipleInstances);
-		SavedAssetInstanceName = FString();
+		SetSavedAssetInstanceName(FString());
 	}
 }
 
@@ -541,13 +577,27 @@ FFlowComponentSaveData UFlowComponent::SaveInstance()
 	ComponentRecord.WorldName = GetWorld()->GetName();
 	ComponentRecord.ActorInstanceName = GetOwner()->GetName();
 
+	const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	FFlowSaveNameTable* NameTable = FlowSubsystem ? FlowSubsystem->GetActiveSaveNameTable() : nullptr;
+
+	if (bCacheSaveData && !bSaveDirty && CachedSaveFormatId == FlowSave::GetFormatId(NameTable))
+	{
+		ComponentRecord.ComponentData = CachedSaveData;
+		return ComponentRecord;
+	}
+
 	// opportunity to collect data before serializing component
 	OnSave();
 
 	// serialize component
-	FMemoryWriter MemoryWriter(ComponentRecord.ComponentData, true);
-	FFlowArchive Ar(MemoryWriter);
-	Serialize(Ar);
+	FlowSave::WriteObject(*this, ComponentRecord.ComponentData, NameTable);
+
+	if (bCacheSaveData)
+	{
+		CachedSaveData = ComponentRecord.ComponentData;
+		CachedSaveFormatId = FlowSave::GetFormatId(NameTable);
+		bSaveDirty = false;
+	}
 
 	return ComponentRecord;
 }
@@ -558,10 +608,13 @@ bool UFlowComponent::LoadInstance(const UFlowSubsystem* FlowSubsystem)
 	{
 		if (const FFlowComponentSaveData* Record = FlowSubsystem->GetLoadedComponentRecord(this))
 		{
-			FMemoryReader MemoryReader(Record->ComponentData, true);
-			FFlowArchive Ar(MemoryReader);
-			Serialize(Ar);
+			if (!FlowSave::ReadObject(*this, Record->ComponentData, FlowSubsystem->GetLoadedSaveNameTable()))
+			{
+				UE_LOG(LogFlow, Error, TEXT("Failed to read data of Flow Component owned by %s from SaveGame"), *GetOwner()->GetName());
+				return false;
+			}
 
+			MarkSaveDirty();
 			OnLoad();
 			return true;
 		}
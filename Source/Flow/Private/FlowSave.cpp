@@ -0,0 +1,423 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowSave.h"
+
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowSave)
+
+void FFlowSaveGameIndex::Build(const UFlowSaveGame& SaveGame)
+{
+	Build(SaveGame, SaveGame.FlowComponents, SaveGame.FlowInstances);
+}
+
+void FFlowSaveGameIndex::Build(const UFlowSaveGame& SaveGame, const TArray<FFlowComponentSaveData>& FlowComponents, const TArray<FFlowAssetSaveData>& FlowInstances)
+{
+	Reset();
+
+	IndexedSaveGame = &SaveGame;
+	NumIndexedComponents = FlowComponents.Num();
+	NumIndexedInstances = FlowInstances.Num();
+
+	ComponentRecords.Reserve(NumIndexedComponents);
+	for (int32 Index = 0; Index < NumIndexedComponents; Index++)
+	{
+		const FFlowComponentSaveData& Record = FlowComponents[Index];
+		ComponentRecords.Add(GetComponentKeyHash(Record.WorldName, Record.ActorInstanceName), Index);
+	}
+
+	InstanceRecordsByName.Reserve(NumIndexedInstances);
+	InstanceRecordsByNameAndWorld.Reserve(NumIndexedInstances);
+	for (int32 Index = 0; Index < NumIndexedInstances; Index++)
+	{
+		const FFlowAssetSaveData& Record = FlowInstances[Index];
+		InstanceRecordsByName.Add(GetInstanceKeyHash(Record.InstanceName, nullptr), Index);
+		InstanceRecordsByNameAndWorld.Add(GetInstanceKeyHash(Record.InstanceName, &Record.WorldName), Index);
+	}
+}
+
+void FFlowSaveGameIndex::Reset()
+{
+	IndexedSaveGame.Reset();
+	NumIndexedComponents = 0;
+	NumIndexedInstances = 0;
+
+	ComponentRecords.Reset();
+	InstanceRecordsByName.Reset();
+	InstanceRecordsByNameAndWorld.Reset();
+}
+
+bool FFlowSaveGameIndex::IsUpToDate(const UFlowSaveGame& SaveGame) const
+{
+	return IsUpToDate(SaveGame, SaveGame.FlowComponents, SaveGame.FlowInstances);
+}
+
+bool FFlowSaveGameIndex::IsUpToDate(const UFlowSaveGame& SaveGame, const TArray<FFlowComponentSaveData>& FlowComponents, const TArray<FFlowAssetSaveData>& FlowInstances) const
+{
+	return IndexedSaveGame.Get() == &SaveGame
+		&& NumIndexedComponents == FlowComponents.Num()
+		&& NumIndexedInstances == FlowInstances.Num();
+}
+
+const FFlowComponentSaveData* FFlowSaveGameIndex::FindComponentRecord(const UFlowSaveGame& SaveGame, const FString& WorldName, const FString& ActorInstanceName) const
+{
+	return FindComponentRecord(SaveGame.FlowComponents, WorldName, ActorInstanceName);
+}
+
+const FFlowComponentSaveData* FFlowSaveGameIndex::FindComponentRecord(const TArray<FFlowComponentSaveData>& FlowComponents, const FString& WorldName, const FString& ActorInstanceName) const
+{
+	// hash collisions are possible, so verify the record and pick the earliest one
+	int32 FoundIndex = INDEX_NONE;
+	for (TMultiMap<uint32, int32>::TConstKeyIterator It(ComponentRecords, GetComponentKeyHash(WorldName, ActorInstanceName)); It; ++It)
+	{
+		const int32 Index = It.Value();
+		if ((FoundIndex == INDEX_NONE || Index < FoundIndex) && FlowComponents.IsValidIndex(Index))
+		{
+			const FFlowComponentSaveData& Record = FlowComponents[Index];
+			if (Record.WorldName == WorldName && Record.ActorInstanceName == ActorInstanceName)
+			{
+				FoundIndex = Index;
+			}
+		}
+	}
+
+	return FoundIndex != INDEX_NONE ? &FlowComponents[FoundIndex] : nullptr;
+}
+
+const FFlowAssetSaveData* FFlowSaveGameIndex::FindAssetRecord(const UFlowSaveGame& SaveGame, const FString& InstanceName, const FString* WorldName) const
+{
+	return FindAssetRecord(SaveGame.FlowInstances, InstanceName, WorldName);
+}
+
+const FFlowAssetSaveData* FFlowSaveGameIndex::FindAssetRecord(const TArray<FFlowAssetSaveData>& FlowInstances, const FString& InstanceName, const FString* WorldName) const
+{
+	const TMultiMap<uint32, int32>& InstanceRecords = WorldName ? InstanceRecordsByNameAndWorld : InstanceRecordsByName;
+
+	int32 FoundIndex = INDEX_NONE;
+	for (TMultiMap<uint32, int32>::TConstKeyIterator It(InstanceRecords, GetInstanceKeyHash(InstanceName, WorldName)); It; ++It)
+	{
+		const int32 Index = It.Value();
+		if ((FoundIndex == INDEX_NONE || Index < FoundIndex) && FlowInstances.IsValidIndex(Index))
+		{
+			const FFlowAssetSaveData& Record = FlowInstances[Index];
+			if (Record.InstanceName == InstanceName && (WorldName == nullptr || Record.WorldName == *WorldName))
+			{
+				FoundIndex = Index;
+			}
+		}
+	}
+
+	return FoundIndex != INDEX_NONE ? &FlowInstances[FoundIndex] : nullptr;
+}
+
+uint32 FFlowSaveGameIndex::GetComponentKeyHash(const FString& WorldName, const FString& ActorInstanceName)
+{
+	// GetTypeHash(FString) is case-insensitive, matching FString comparison
+	return HashCombineFast(GetTypeHash(WorldName), GetTypeHash(ActorInstanceName));
+}
+
+uint32 FFlowSaveGameIndex::GetInstanceKeyHash(const FString& InstanceName, const FString* WorldName)
+{
+	return WorldName ? HashCombineFast(GetTypeHash(InstanceName), GetTypeHash(*WorldName)) : GetTypeHash(InstanceName);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Compact format
+
+namespace FlowSave
+{
+	/* Written at the start of compact data. Data written by FFlowArchive starts with a property name, which length can't be this large. */
+	static constexpr uint32 CompactDataTag = 0x7F434C46;
+
+	static constexpr uint32 CompactDataVersion_Initial = 1;
+	static constexpr uint32 CompactDataVersion_TableId = 2; // id of the name table follows the version
+	static constexpr uint32 CompactDataVersion = CompactDataVersion_TableId;
+}
+
+int32 FFlowSaveNameTable::FindOrAdd(const FString& String)
+{
+	InitializeId();
+
+	if (EntryIndices.Num() != Entries.Num())
+	{
+		// table has been copied or loaded
+		EntryIndices.Reset();
+		EntryIndices.Reserve(Entries.Num());
+		for (int32 Index = 0; Index < Entries.Num(); Index++)
+		{
+			EntryIndices.Add(Entries[Index], Index);
+		}
+	}
+
+	if (const int32* Index = EntryIndices.Find(String))
+	{
+		return *Index;
+	}
+
+	const int32 NewIndex = Entries.Add(String);
+	EntryIndices.Add(String, NewIndex);
+	return NewIndex;
+}
+
+void FFlowSaveNameTable::SerializeEntries(FArchive& Ar)
+{
+	Ar << Id;
+
+	int32 NumEntries = Entries.Num();
+	Ar << NumEntries;
+
+	if (Ar.IsLoading())
+	{
+		Entries.Reset();
+		EntryIndices.Reset();
+
+		if (!FlowSave::IsValidLoadedNum(Ar, NumEntries))
+		{
+			Ar.SetError();
+			return;
+		}
+		Entries.SetNum(NumEntries);
+	}
+
+	for (FString& Entry : Entries)
+	{
+		Ar << Entry;
+	}
+}
+
+FFlowCompactArchive::FFlowCompactArchive(FArchive& InInnerArchive, FFlowSaveNameTable& InNameTable)
+	: FFlowArchive(InInnerArchive)
+	, WritableNameTable(&InNameTable)
+	, NameTable(InNameTable)
+{
+	check(IsSaving());
+}
+
+FFlowCompactArchive::FFlowCompactArchive(FArchive& InInnerArchive, const FFlowSaveNameTable& InNameTable)
+	: FFlowArchive(InInnerArchive)
+	, WritableNameTable(nullptr)
+	, NameTable(InNameTable)
+{
+	check(IsLoading());
+}
+
+FArchive& FFlowCompactArchive::operator<<(FName& Value)
+{
+	FString String = IsSaving() ? Value.ToString() : FString();
+	SerializeTableEntry(String);
+
+	if (IsLoading())
+	{
+		Value = FName(*String);
+	}
+
+	return *this;
+}
+
+FArchive& FFlowCompactArchive::operator<<(UObject*& Value)
+{
+	FString Path = IsSaving() && Value ? Value->GetPathName() : FString();
+	SerializeTableEntry(Path);
+
+	if (IsLoading())
+	{
+		Value = nullptr;
+		if (!Path.IsEmpty())
+		{
+			// same as FObjectAndNameAsStringProxyArchive, load the object if it's not in memory
+			Value = FindObject<UObject>(nullptr, *Path, false);
+			if (Value == nullptr && bLoadIfFindFails)
+			{
+				Value = LoadObject<UObject>(nullptr, *Path);
+			}
+		}
+	}
+
+	return *this;
+}
+
+FArchive& FFlowCompactArchive::operator<<(FObjectPtr& Value)
+{
+	UObject* Object = IsSaving() ? Value.Get() : nullptr;
+	*this << Object;
+
+	if (IsLoading())
+	{
+		Value = Object;
+	}
+
+	return *this;
+}
+
+void FFlowCompactArchive::SerializeTableEntry(FString& Value)
+{
+	uint32 Index = 0;
+	if (IsSaving())
+	{
+		// 0 is reserved for empty string, so object references are usually a single byte
+		Index = Value.IsEmpty() ? 0 : static_cast<uint32>(WritableNameTable->FindOrAdd(Value)) + 1;
+	}
+
+	SerializeIntPacked(Index);
+
+	if (IsLoading())
+	{
+		Value.Reset();
+		if (Index > 0)
+		{
+			if (const FString* Entry = NameTable.Find(static_cast<int32>(Index) - 1))
+			{
+				Value = *Entry;
+			}
+			else
+			{
+				SetError();
+			}
+		}
+	}
+}
+
+void FlowSave::WriteObject(UObject& Object, TArray<uint8>& OutData, FFlowSaveNameTable* NameTable)
+{
+	OutData.Reset();
+	FMemoryWriter MemoryWriter(OutData, true);
+
+	if (NameTable)
+	{
+		uint32 Tag = CompactDataTag;
+		uint32 Version = CompactDataVersion;
+		MemoryWriter << Tag;
+		MemoryWriter << Version;
+
+		NameTable->InitializeId();
+		FGuid TableId = NameTable->GetId();
+		MemoryWriter << TableId;
+
+		FFlowCompactArchive Ar(MemoryWriter, *NameTable);
+		Object.Serialize(Ar);
+	}
+	else
+	{
+		FFlowArchive Ar(MemoryWriter);
+		Object.Serialize(Ar);
+	}
+}
+
+bool FlowSave::ReadObject(UObject& Object, const TArray<uint8>& Data, const FFlowSaveNameTable* NameTable)
+{
+	FMemoryReader MemoryReader(Data, true);
+
+	uint32 Tag = 0;
+	uint32 Version = 0;
+	if (Data.Num() >= sizeof(Tag) + sizeof(Version))
+	{
+		MemoryReader << Tag;
+		MemoryReader << Version;
+	}
+
+	if (Tag == CompactDataTag)
+	{
+		if (NameTable == nullptr || Version > CompactDataVersion)
+		{
+			return false;
+		}
+
+		if (Version >= CompactDataVersion_TableId)
+		{
+			// indices are meaningless with any other table, i.e. record copied from another save container
+			FGuid TableId;
+			MemoryReader << TableId;
+			if (TableId != NameTable->GetId())
+			{
+				return false;
+			}
+		}
+
+		FFlowCompactArchive Ar(MemoryReader, *NameTable);
+		Object.Serialize(Ar);
+		return !Ar.IsError();
+	}
+
+	// data written before compact format existed, or with compact format disabled
+	MemoryReader.Seek(0);
+	FFlowArchive Ar(MemoryReader);
+	Object.Serialize(Ar);
+	return true;
+}
+
+bool FlowSave::IsValidLoadedNum(FArchive& Ar, const int64 Num)
+{
+	// every element takes at least a byte, archives of unknown size can't be checked
+	const int64 TotalSize = Ar.TotalSize();
+	return Num >= 0 && (TotalSize < 0 || Num <= TotalSize - Ar.Tell());
+}
+
+bool FlowSave::IsWrittenWithNameTable(const TArray<uint8>& Data, const FGuid& TableId)
+{
+	FMemoryReader MemoryReader(Data, true);
+
+	uint32 Tag = 0;
+	uint32 Version = 0;
+	if (Data.Num() >= sizeof(Tag) + sizeof(Version))
+	{
+		MemoryReader << Tag;
+		MemoryReader << Version;
+	}
+
+	if (Tag != CompactDataTag)
+	{
+		return false;
+	}
+
+	// data written before tables had ids can be read with any table
+	if (Version < CompactDataVersion_TableId)
+	{
+		return true;
+	}
+
+	FGuid DataTableId;
+	MemoryReader << DataTableId;
+	return !MemoryReader.IsError() && DataTableId == TableId;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Save Game
+
+namespace FlowSave
+{
+	static constexpr int32 RecordsFormatMarker = -1;
+	static constexpr int32 RecordsVersion_NameTable = 1;
+	static constexpr int32 RecordsVersion = RecordsVersion_NameTable;
+}
+
+void UFlowSaveGame::SerializeRecords(FArchive& Ar)
+{
+	int32 FormatMarker = FlowSave::RecordsFormatMarker;
+	Ar << FormatMarker;
+
+	if (Ar.IsLoading() && FormatMarker >= 0)
+	{
+		// legacy data, the marker is actually the number of component records
+		FlowComponents.SetNum(FormatMarker);
+		for (FFlowComponentSaveData& ComponentRecord : FlowComponents)
+		{
+			Ar << ComponentRecord;
+		}
+		Ar << FlowInstances;
+		NameTable = FFlowSaveNameTable();
+		return;
+	}
+
+	int32 Version = FlowSave::RecordsVersion;
+	Ar << Version;
+	if (Version > FlowSave::RecordsVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << FlowComponents;
+	Ar << FlowInstances;
+	Ar << NameTable;
+}
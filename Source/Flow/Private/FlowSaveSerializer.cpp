@@ -0,0 +1,351 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowSaveSerializer.h"
+#include "FlowLogChannels.h"
+
+#include "Async/Async.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tasks/Task.h"
+
+DECLARE_CYCLE_STAT(TEXT("Encode Save"), STAT_FlowEncodeSave, STATGROUP_Flow);
+DECLARE_CYCLE_STAT(TEXT("Decode Save"), STAT_FlowDecodeSave, STATGROUP_Flow);
+
+namespace FlowSaveSerializer
+{
+	/* Record identity strings are kept exactly as written, unlike the default case-insensitive FString keys. */
+	struct FCaseSensitiveStringKeyFuncs : TDefaultMapHashableKeyFuncs<FString, int32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	template <typename RecordType>
+	void SerializeTaggedRecords(FArchive& Ar, TArray<RecordType>& Records)
+	{
+		int32 NumRecords = Records.Num();
+		Ar << NumRecords;
+
+		if (Ar.IsLoading())
+		{
+			if (!FlowSave::IsValidLoadedNum(Ar, NumRecords))
+			{
+				Ar.SetError();
+				return;
+			}
+			Records.SetNum(NumRecords);
+		}
+
+		UScriptStruct* RecordStruct = RecordType::StaticStruct();
+		for (RecordType& Record : Records)
+		{
+			RecordStruct->SerializeItem(Ar, &Record, nullptr);
+			if (Ar.IsError())
+			{
+				return;
+			}
+		}
+	}
+
+	/* Writes index of the value in the table, or reads the value back. */
+	template <typename ValueType>
+	void SerializeIndex(FArchive& Ar, ValueType& Value, const TArray<ValueType>& Table, const TFunctionRef<int32(const ValueType&)> FindIndex)
+	{
+		uint32 Index = Ar.IsSaving() ? static_cast<uint32>(FindIndex(Value)) : 0;
+		Ar.SerializeIntPacked(Index);
+
+		if (Ar.IsLoading())
+		{
+			if (Table.IsValidIndex(static_cast<int32>(Index)))
+			{
+				Value = Table[Index];
+			}
+			else
+			{
+				Ar.SetError();
+			}
+		}
+	}
+
+	void SerializeNum(FArchive& Ar, int32& Num)
+	{
+		uint32 PackedNum = static_cast<uint32>(Num);
+		Ar.SerializeIntPacked(PackedNum);
+		Num = static_cast<int32>(PackedNum);
+
+		if (Ar.IsLoading() && !FlowSave::IsValidLoadedNum(Ar, Num))
+		{
+			Num = 0;
+			Ar.SetError();
+		}
+	}
+
+	/* Same layout as TArray serialization, but loading checks the element count before allocating. */
+	template <typename ElementType>
+	void SerializeArray(FArchive& Ar, TArray<ElementType>& Array)
+	{
+		int32 Num = Array.Num();
+		Ar << Num;
+
+		if (Ar.IsLoading())
+		{
+			Array.Reset();
+			if (!FlowSave::IsValidLoadedNum(Ar, Num))
+			{
+				Ar.SetError();
+				return;
+			}
+
+			if constexpr (std::is_same_v<ElementType, uint8>)
+			{
+				Array.SetNumUninitialized(Num);
+			}
+			else
+			{
+				Array.SetNum(Num);
+			}
+		}
+
+		if constexpr (std::is_same_v<ElementType, uint8>)
+		{
+			Ar.Serialize(Array.GetData(), Num);
+		}
+		else
+		{
+			for (ElementType& Element : Array)
+			{
+				Ar << Element;
+			}
+		}
+	}
+}
+
+void FFlowSaveSerializer::SerializeTaggedRecords(FArchive& Ar, FFlowSaveSnapshot& Snapshot)
+{
+	FlowSaveSerializer::SerializeTaggedRecords(Ar, Snapshot.FlowComponents);
+	FlowSaveSerializer::SerializeTaggedRecords(Ar, Snapshot.FlowInstances);
+}
+
+void FFlowSaveSerializer::SerializeCompactRecords(FArchive& Ar, FFlowSaveSnapshot& Snapshot)
+{
+	TArray<FString> Strings;
+	TArray<FGuid> Guids;
+	TMap<FString, int32, FDefaultSetAllocator, FlowSaveSerializer::FCaseSensitiveStringKeyFuncs> StringIndices;
+	TMap<FGuid, int32> GuidIndices;
+
+	if (Ar.IsSaving())
+	{
+		const auto AddString = [&Strings, &StringIndices](const FString& String)
+		{
+			if (!StringIndices.Contains(String))
+			{
+				StringIndices.Add(String, Strings.Add(String));
+			}
+		};
+
+		for (const FFlowComponentSaveData& Record : Snapshot.FlowComponents)
+		{
+			AddString(Record.WorldName);
+			AddString(Record.ActorInstanceName);
+		}
+
+		for (const FFlowAssetSaveData& Record : Snapshot.FlowInstances)
+		{
+			AddString(Record.WorldName);
+			AddString(Record.InstanceName);
+
+			// instances of the same Flow Asset share node Guids
+			for (const FFlowNodeSaveData& NodeRecord : Record.NodeRecords)
+			{
+				if (!GuidIndices.Contains(NodeRecord.NodeGuid))
+				{
+					GuidIndices.Add(NodeRecord.NodeGuid, Guids.Add(NodeRecord.NodeGuid));
+				}
+			}
+		}
+	}
+
+	FlowSaveSerializer::SerializeArray(Ar, Strings);
+	FlowSaveSerializer::SerializeArray(Ar, Guids);
+	Ar << Snapshot.NameTable;
+	if (Ar.IsError())
+	{
+		return;
+	}
+
+	const auto FindString = [&StringIndices](const FString& String) { return StringIndices.FindChecked(String); };
+	const auto FindGuid = [&GuidIndices](const FGuid& Guid) { return GuidIndices.FindChecked(Guid); };
+
+	int32 NumComponents = Snapshot.FlowComponents.Num();
+	FlowSaveSerializer::SerializeNum(Ar, NumComponents);
+	if (Ar.IsLoading() && !Ar.IsError())
+	{
+		Snapshot.FlowComponents.SetNum(NumComponents);
+	}
+
+	for (FFlowComponentSaveData& Record : Snapshot.FlowComponents)
+	{
+		FlowSaveSerializer::SerializeIndex<FString>(Ar, Record.WorldName, Strings, FindString);
+		FlowSaveSerializer::SerializeIndex<FString>(Ar, Record.ActorInstanceName, Strings, FindString);
+		FlowSaveSerializer::SerializeArray(Ar, Record.ComponentData);
+
+		if (Ar.IsError())
+		{
+			return;
+		}
+	}
+
+	int32 NumInstances = Snapshot.FlowInstances.Num();
+	FlowSaveSerializer::SerializeNum(Ar, NumInstances);
+	if (Ar.IsLoading() && !Ar.IsError())
+	{
+		Snapshot.FlowInstances.SetNum(NumInstances);
+	}
+
+	for (FFlowAssetSaveData& Record : Snapshot.FlowInstances)
+	{
+		FlowSaveSerializer::SerializeIndex<FString>(Ar, Record.WorldName, Strings, FindString);
+		FlowSaveSerializer::SerializeIndex<FString>(Ar, Record.InstanceName, Strings, FindString);
+		FlowSaveSerializer::SerializeArray(Ar, Record.AssetData);
+
+		int32 NumNodes = Record.NodeRecords.Num();
+		FlowSaveSerializer::SerializeNum(Ar, NumNodes);
+		if (Ar.IsError())
+		{
+			return;
+		}
+
+		if (Ar.IsLoading())
+		{
+			Record.NodeRecords.SetNum(NumNodes);
+		}
+
+		for (FFlowNodeSaveData& NodeRecord : Record.NodeRecords)
+		{
+			FlowSaveSerializer::SerializeIndex<FGuid>(Ar, NodeRecord.NodeGuid, Guids, FindGuid);
+			FlowSaveSerializer::SerializeArray(Ar, NodeRecord.NodeData);
+
+			if (Ar.IsError())
+			{
+				return;
+			}
+		}
+	}
+}
+
+bool FFlowSaveSerializer::Encode(const FFlowSaveSnapshot& Snapshot, TArray<uint8>& OutData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlowEncodeSave);
+
+	// records are only read while saving
+	FFlowSaveSnapshot& MutableSnapshot = const_cast<FFlowSaveSnapshot&>(Snapshot);
+
+	TArray<uint8> RawData;
+	{
+		FMemoryWriter Ar(RawData, true);
+		SerializeCompactRecords(Ar, MutableSnapshot);
+
+		if (Ar.IsError())
+		{
+			return false;
+		}
+	}
+
+	int32 UncompressedSize = RawData.Num();
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, UncompressedSize);
+
+	TArray<uint8> CompressedData;
+	CompressedData.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Oodle, CompressedData.GetData(), CompressedSize, RawData.GetData(), UncompressedSize))
+	{
+		return false;
+	}
+	CompressedData.SetNum(CompressedSize, EAllowShrinking::No);
+
+	OutData.Reset();
+	FMemoryWriter Writer(OutData, true);
+
+	uint32 Header = Magic;
+	int32 Version = static_cast<int32>(EVersion::Latest);
+	Writer << Header;
+	Writer << Version;
+	Writer << UncompressedSize;
+	Writer << CompressedData;
+
+	return !Writer.IsError();
+}
+
+bool FFlowSaveSerializer::Decode(const TArray<uint8>& Data, FFlowSaveSnapshot& OutSnapshot)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlowDecodeSave);
+
+	FMemoryReader Reader(Data, true);
+
+	uint32 Header = 0;
+	int32 Version = 0;
+	int32 UncompressedSize = 0;
+	Reader << Header;
+	Reader << Version;
+	Reader << UncompressedSize;
+
+	if (Reader.IsError() || Header != Magic || Version <= 0 || Version > static_cast<int32>(EVersion::Latest)
+		|| UncompressedSize < 0 || UncompressedSize > MaxUncompressedSize)
+	{
+		return false;
+	}
+
+	TArray<uint8> CompressedData;
+	FlowSaveSerializer::SerializeArray(Reader, CompressedData);
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	TArray<uint8> RawData;
+	RawData.SetNumUninitialized(UncompressedSize);
+	if (!FCompression::UncompressMemory(NAME_Oodle, RawData.GetData(), UncompressedSize, CompressedData.GetData(), CompressedData.Num()))
+	{
+		return false;
+	}
+
+	FMemoryReader MemoryReader(RawData, true);
+	if (Version < static_cast<int32>(EVersion::CompactRecords))
+	{
+		FFlowArchive Ar(MemoryReader);
+		SerializeTaggedRecords(Ar, OutSnapshot);
+		return !Ar.IsError();
+	}
+
+	SerializeCompactRecords(MemoryReader, OutSnapshot);
+	return !MemoryReader.IsError();
+}
+
+void FFlowSaveSerializer::EncodeAsync(FFlowSaveSnapshot&& Snapshot, FFlowSaveEncodedDelegate&& OnCompleted)
+{
+	EncodeAsync(MakeShared<const FFlowSaveSnapshot, ESPMode::ThreadSafe>(MoveTemp(Snapshot)), MoveTemp(OnCompleted));
+}
+
+void FFlowSaveSerializer::EncodeAsync(const TSharedRef<const FFlowSaveSnapshot, ESPMode::ThreadSafe>& Snapshot, FFlowSaveEncodedDelegate&& OnCompleted)
+{
+	check(IsInGameThread());
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Snapshot = TSharedPtr<const FFlowSaveSnapshot, ESPMode::ThreadSafe>(Snapshot), OnCompleted = MoveTemp(OnCompleted)]() mutable
+	{
+		TArray<uint8> EncodedData;
+		const bool bSuccess = Encode(*Snapshot, EncodedData);
+
+		// worker is done with the snapshot by the time OnCompleted is called
+		Snapshot.Reset();
+
+		if (!bSuccess)
+		{
+			UE_LOG(LogFlow, Error, TEXT("Failed to encode Flow save data"));
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [bSuccess, EncodedData = MoveTemp(EncodedData), OnCompleted = MoveTemp(OnCompleted)]()
+		{
+			OnCompleted.ExecuteIfBound(bSuccess, EncodedData);
+		});
+	});
+}
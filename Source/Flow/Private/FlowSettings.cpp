@@ -17,8 +17,10 @@ UFlowSettings::UFlowSettings(const FObjectInitializer& ObjectInitializer)
 	, bLogOnSignalPassthrough(true)
 	, bCreateFlowSubsystemOnClients(true)
 	, bUseAdaptiveNodeTitles(false)
+	, bCacheDataPinValuesWhileEvaluating(false)
 	, DefaultExpectedOwnerClass(UFlowComponent::StaticClass())
 	, bWarnAboutMissingIdentityTags(true)
+	, bCompactSaveData(false)
 {
 }
 
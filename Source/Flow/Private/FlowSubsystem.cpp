@@ -8,6 +8,7 @@
 #include "FlowSave.h"
 #include "FlowSettings.h"
 #include "Interfaces/FlowExecutionGate.h"
+#include "Nodes/Actor/FlowNode_ComponentObserver.h"
 #include "Nodes/Graph/FlowNode_SubGraph.h"
 
 #include "Engine/GameInstance.h"
@@ -23,6 +24,8 @@ FNativeFlowAssetEvent UFlowSubsystem::OnInstancedTemplateAdded;
 FNativeFlowAssetEvent UFlowSubsystem::OnInstancedTemplateRemoved;
 #endif
 
+DECLARE_CYCLE_STAT(TEXT("Capture Save"), STAT_FlowCaptureSave, STATGROUP_Flow);
+
 #define LOCTEXT_NAMESPACE "FlowSubsystem"
 
 UFlowSubsystem::UFlowSubsystem()
@@ -58,6 +61,8 @@ void UFlowSubsystem::Deinitialize()
 {
 	AbortActiveFlows();
 	ClearLoadedSaveGame();
+
+	TimerWheels.Empty();
 }
 
 void UFlowSubsystem::AbortActiveFlows()
@@ -77,6 +82,10 @@ void UFlowSubsystem::AbortActiveFlows()
 	InstancedSubFlows.Empty();
 
 	RootInstances.Empty();
+	RootInstancesByOwner.Empty();
+
+	// instances finished above might have been pooled
+	ClearInstancePools();
 }
 
 void UFlowSubsystem::StartRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const TScriptInterface<IFlowDataPinValueSupplierInterface> DataPinValueSupplier, const bool bAllowMultipleInstances)
@@ -99,12 +108,15 @@ void UFlowSubsystem::StartRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const
 
 UFlowAsset* UFlowSubsystem::CreateRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances, const FString& NewInstanceName)
 {
-	for (const TPair<UFlowAsset*, TWeakObjectPtr<UObject>>& RootInstance : ObjectPtrDecay(RootInstances))
+	if (const FlowArray::TInlineArray<UFlowAsset*, 1>* OwnerInstances = RootInstancesByOwner.Find(FObjectKey(Owner)))
 	{
-		if (Owner == RootInstance.Value.Get() && FlowAsset == RootInstance.Key->GetTemplateAsset())
+		for (const UFlowAsset* RootInstance : *OwnerInstances)
 		{
-			UE_LOG(LogFlow, Warning, TEXT("Attempted to start Root Flow for the same Owner again. Owner: %s. Flow Asset: %s."), *Owner->GetName(), *FlowAsset->GetName());
-			return nullptr;
+			if (FlowAsset == RootInstance->GetTemplateAsset())
+			{
+				UE_LOG(LogFlow, Warning, TEXT("Attempted to start Root Flow for the same Owner again. Owner: %s. Flow Asset: %s."), *Owner->GetName(), *FlowAsset->GetName());
+				return nullptr;
+			}
 		}
 	}
 
@@ -117,7 +129,7 @@ UFlowAsset* UFlowSubsystem::CreateRootFlow(UObject* Owner, UFlowAsset* FlowAsset
 	UFlowAsset* NewFlow = CreateFlowInstance(Owner, FlowAsset, NewInstanceName);
 	if (NewFlow)
 	{
-		RootInstances.Add(NewFlow, Owner);
+		AddRootInstance(NewFlow, Owner);
 	}
 
 	return NewFlow;
@@ -127,38 +139,85 @@ void UFlowSubsystem::FinishRootFlow(UObject* Owner, UFlowAsset* TemplateAsset, c
 {
 	UFlowAsset* InstanceToFinish = nullptr;
 
-	for (TPair<TObjectPtr<UFlowAsset>, TWeakObjectPtr<UObject>>& RootInstance : RootInstances)
+	if (const FlowArray::TInlineArray<UFlowAsset*, 1>* OwnerInstances = Owner ? RootInstancesByOwner.Find(FObjectKey(Owner)) : nullptr)
 	{
-		if (Owner && Owner == RootInstance.Value.Get() && RootInstance.Key && RootInstance.Key->GetTemplateAsset() == TemplateAsset)
+		for (UFlowAsset* RootInstance : *OwnerInstances)
 		{
-			InstanceToFinish = RootInstance.Key;
-			break;
+			if (RootInstance && RootInstance->GetTemplateAsset() == TemplateAsset)
+			{
+				InstanceToFinish = RootInstance;
+				break;
+			}
 		}
 	}
 
 	if (InstanceToFinish)
 	{
-		RootInstances.Remove(InstanceToFinish);
+		RemoveRootInstance(InstanceToFinish);
 		InstanceToFinish->FinishFlow(FinishPolicy);
 	}
 }
 
 void UFlowSubsystem::FinishAllRootFlows(UObject* Owner, const EFlowFinishPolicy FinishPolicy)
 {
-	TArray<UFlowAsset*> InstancesToFinish;
+	if (Owner == nullptr)
+	{
+		return;
+	}
 
-	for (TPair<TObjectPtr<UFlowAsset>, TWeakObjectPtr<UObject>>& RootInstance : RootInstances)
+	// copy, as finishing instances modifies the index
+	const FlowArray::TInlineArray<UFlowAsset*, 1> InstancesToFinish = RootInstancesByOwner.FindRef(FObjectKey(Owner));
+
+	for (UFlowAsset* InstanceToFinish : InstancesToFinish)
+	{
+		RemoveRootInstance(InstanceToFinish);
+		InstanceToFinish->FinishFlow(FinishPolicy);
+	}
+}
+
+void UFlowSubsystem::AddRootInstance(UFlowAsset* Instance, UObject* Owner)
+{
+	RootInstances.Add(Instance, Owner);
+	RootInstancesByOwner.FindOrAdd(FObjectKey(Owner)).Add(Instance);
+}
+
+void UFlowSubsystem::RemoveRootInstance(UFlowAsset* Instance)
+{
+	TWeakObjectPtr<UObject> Owner;
+	if (!RootInstances.RemoveAndCopyValue(Instance, Owner))
 	{
-		if (Owner && Owner == RootInstance.Value.Get() && RootInstance.Key)
+		return;
+	}
+
+	auto RemoveFromOwnerIndex = [this, Instance](const FObjectKey& OwnerKey) -> bool
+	{
+		if (FlowArray::TInlineArray<UFlowAsset*, 1>* OwnerInstances = RootInstancesByOwner.Find(OwnerKey))
 		{
-			InstancesToFinish.Emplace(RootInstance.Key);
+			if (OwnerInstances->Remove(Instance) > 0)
+			{
+				if (OwnerInstances->IsEmpty())
+				{
+					RootInstancesByOwner.Remove(OwnerKey);
+				}
+				return true;
+			}
 		}
+		return false;
+	};
+
+	if (Owner.IsValid() && RemoveFromOwnerIndex(FObjectKey(Owner.Get())))
+	{
+		return;
 	}
 
-	for (UFlowAsset* InstanceToFinish : InstancesToFinish)
+	// owner has been destroyed in the meantime, its key can't be recreated from the stale weak pointer
+	for (const TPair<FObjectKey, FlowArray::TInlineArray<UFlowAsset*, 1>>& OwnerInstances : RootInstancesByOwner)
 	{
-		RootInstances.Remove(InstanceToFinish);
-		InstanceToFinish->FinishFlow(FinishPolicy);
+		if (OwnerInstances.Value.Contains(Instance))
+		{
+			RemoveFromOwnerIndex(OwnerInstances.Key);
+			break;
+		}
 	}
 }
 
@@ -228,13 +287,29 @@ UFlowAsset* UFlowSubsystem::CreateFlowInstance(const TWeakObjectPtr<UObject> Own
 	}
 #endif
 
+	UFlowAsset* NewInstance = nullptr;
+
 	// it won't be empty, if we're restoring Flow Asset instance from the SaveGame
 	if (NewInstanceName.IsEmpty())
 	{
-		NewInstanceName = MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *FPaths::GetBaseFilename(LoadedFlowAsset->GetPathName())).ToString();
+		if (LoadedFlowAsset->GetInstancePoolSettings().bEnabled && !InstancePools.Contains(LoadedFlowAsset))
+		{
+			WarmUpInstancePool(LoadedFlowAsset);
+		}
+
+		NewInstance = TryAcquirePooledInstance(*LoadedFlowAsset);
+
+		if (NewInstance == nullptr)
+		{
+			NewInstanceName = MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *FPaths::GetBaseFilename(LoadedFlowAsset->GetPathName())).ToString();
+		}
+	}
+
+	if (NewInstance == nullptr)
+	{
+		NewInstance = NewObject<UFlowAsset>(this, LoadedFlowAsset->GetClass(), *NewInstanceName, RF_Transient, LoadedFlowAsset, false, nullptr);
 	}
 
-	UFlowAsset* NewInstance = NewObject<UFlowAsset>(this, LoadedFlowAsset->GetClass(), *NewInstanceName, RF_Transient, LoadedFlowAsset, false, nullptr);
 	NewInstance->InitializeInstance(Owner, *LoadedFlowAsset);
 
 	LoadedFlowAsset->AddInstance(NewInstance);
@@ -265,6 +340,122 @@ void UFlowSubsystem::RemoveInstancedTemplate(UFlowAsset* Template)
 	InstancedTemplates.Remove(Template);
 }
 
+UFlowAsset* UFlowSubsystem::TryAcquirePooledInstance(UFlowAsset& TemplateAsset)
+{
+	if (!TemplateAsset.GetInstancePoolSettings().bEnabled)
+	{
+		return nullptr;
+	}
+
+	FFlowInstancePool& Pool = FindOrAddInstancePool(TemplateAsset);
+	while (Pool.FreeInstances.Num() > 0)
+	{
+		UFlowAsset* Instance = Pool.FreeInstances.Pop(EAllowShrinking::No);
+		if (IsValid(Instance))
+		{
+			Pool.Stats.NumHits++;
+
+			// named like a newly created instance
+			const FName InstanceName = MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *FPaths::GetBaseFilename(TemplateAsset.GetPathName()));
+			Instance->Rename(*InstanceName.ToString(), nullptr, REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional);
+
+			// clear state left by the previous run, nodes which don't reset their state are created again in InitializeInstance
+			Instance->NodeOwningThisAssetInstance = nullptr;
+			Instance->ActiveSubGraphs.Empty();
+			Instance->ResetNodes();
+
+			return Instance;
+		}
+	}
+
+	Pool.Stats.NumMisses++;
+	return nullptr;
+}
+
+bool UFlowSubsystem::ReleaseInstanceToPool(UFlowAsset& TemplateAsset, UFlowAsset& Instance)
+{
+	const FFlowInstancePoolSettings& PoolSettings = TemplateAsset.GetInstancePoolSettings();
+	if (!PoolSettings.bEnabled)
+	{
+		return false;
+	}
+
+	FFlowInstancePool& Pool = FindOrAddInstancePool(TemplateAsset);
+	if (Pool.FreeInstances.Num() >= PoolSettings.MaxPooledInstances)
+	{
+		return false;
+	}
+
+	Instance.Rename(*MakePooledInstanceName(TemplateAsset).ToString(), nullptr, REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional);
+	Instance.OnAddedToInstancePool();
+
+	Pool.FreeInstances.Add(&Instance);
+	return true;
+}
+
+FFlowInstancePool& UFlowSubsystem::FindOrAddInstancePool(UFlowAsset& TemplateAsset)
+{
+	if (FFlowInstancePool* Pool = InstancePools.Find(&TemplateAsset))
+	{
+		return *Pool;
+	}
+
+	// adding a pool is rare, drop pools of templates unloaded in the meantime
+	for (TMap<TWeakObjectPtr<UFlowAsset>, FFlowInstancePool>::TIterator It = InstancePools.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	return InstancePools.Add(&TemplateAsset);
+}
+
+FName UFlowSubsystem::MakePooledInstanceName(const UFlowAsset& TemplateAsset)
+{
+	return MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *FString::Printf(TEXT("Pooled_%s"), *FPaths::GetBaseFilename(TemplateAsset.GetPathName())));
+}
+
+void UFlowSubsystem::WarmUpInstancePool(UFlowAsset* TemplateAsset)
+{
+	if (!IsValid(TemplateAsset) || !TemplateAsset->GetInstancePoolSettings().bEnabled)
+	{
+		return;
+	}
+
+	const FFlowInstancePoolSettings& PoolSettings = TemplateAsset->GetInstancePoolSettings();
+	FFlowInstancePool& Pool = FindOrAddInstancePool(*TemplateAsset);
+
+	const int32 TargetNum = FMath::Min(PoolSettings.WarmUpInstances, PoolSettings.MaxPooledInstances);
+	while (Pool.FreeInstances.Num() < TargetNum)
+	{
+		UFlowAsset* NewInstance = NewObject<UFlowAsset>(this, TemplateAsset->GetClass(), MakePooledInstanceName(*TemplateAsset), RF_Transient, TemplateAsset, false, nullptr);
+		NewInstance->InstantiateNodes();
+		NewInstance->OnAddedToInstancePool();
+
+		Pool.FreeInstances.Add(NewInstance);
+	}
+}
+
+FFlowInstancePoolStats UFlowSubsystem::GetInstancePoolStats(UFlowAsset* TemplateAsset) const
+{
+	FFlowInstancePoolStats Result;
+
+	if (const FFlowInstancePool* Pool = InstancePools.Find(TemplateAsset))
+	{
+		Result = Pool->Stats;
+		Result.NumPooled = Pool->FreeInstances.Num();
+	}
+
+	return Result;
+}
+
+void UFlowSubsystem::ClearInstancePools()
+{
+	InstancePools.Empty();
+}
+
 bool UFlowSubsystem::TryFlushAllDeferredTriggerScopes() const
 {
 	// Flush deferred triggers on all active runtime instances.
@@ -335,11 +526,11 @@ TMap<UObject*, UFlowAsset*> UFlowSubsystem::GetRootInstances() const
 TSet<UFlowAsset*> UFlowSubsystem::GetRootInstancesByOwner(const UObject* Owner) const
 {
 	TSet<UFlowAsset*> Result;
-	for (const TPair<UFlowAsset*, TWeakObjectPtr<UObject>>& RootInstance : ObjectPtrDecay(RootInstances))
+	if (Owner)
 	{
-		if (Owner && RootInstance.Value == Owner)
+		if (const FlowArray::TInlineArray<UFlowAsset*, 1>* OwnerInstances = RootInstancesByOwner.Find(FObjectKey(Owner)))
 		{
-			Result.Emplace(RootInstance.Key);
+			Result.Append(*OwnerInstances);
 		}
 	}
 	return Result;
@@ -356,16 +547,136 @@ UFlowAsset* UFlowSubsystem::GetRootFlow(const UObject* Owner) const
 	return nullptr;
 }
 
+FFlowTimerWheel* UFlowSubsystem::GetTimerWheel(UWorld* World)
+{
+	if (World == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (const TUniquePtr<FFlowTimerWheel>* TimerWheel = TimerWheels.Find(World))
+	{
+		return TimerWheel->Get();
+	}
+
+	// drop wheels of worlds already torn down, i.e. after level travel
+	for (TMap<FObjectKey, TUniquePtr<FFlowTimerWheel>>::TIterator It = TimerWheels.CreateIterator(); It; ++It)
+	{
+		if (It.Value()->GetWorld() == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	return TimerWheels.Emplace(World, MakeUnique<FFlowTimerWheel>(World)).Get();
+}
+
 void UFlowSubsystem::OnGameSaved(UFlowSaveGame* SaveGame)
 {
 	if (SaveGame)
 	{
-		OnGameSaved(SaveGame->FlowComponents, SaveGame->FlowInstances);
+		ReclaimLentSaveRecords(*SaveGame);
+
+		if (GetDefault<UFlowSettings>()->bCompactSaveData)
+		{
+			RotateSaveNameTableIfStale();
+
+			// records kept from the previous use of this container might have been written with its own table, i.e. loaded from disk
+			// every compact record stores id of its table, so records copied from another container fail to load instead of reading wrong names
+			const bool bUseOwnTable = SaveGame->NameTable.GetId() != SaveNameTable.GetId() && AreKeptRecordsUsingOwnNameTable(*SaveGame);
+			const bool bNewSessionTable = !bUseOwnTable && SaveNameTable.IsEmpty();
+
+			FFlowSaveNameTable* NameTable = bUseOwnTable ? &SaveGame->NameTable : &SaveNameTable;
+			NameTable->InitializeId();
+
+			TGuardValue<FFlowSaveNameTable*> NameTableGuard(ActiveSaveNameTable, NameTable);
+			OnGameSaved(SaveGame->FlowComponents, SaveGame->FlowInstances);
+
+			if (!bUseOwnTable)
+			{
+				if (bNewSessionTable)
+				{
+					NumSaveNamesInUse = SaveNameTable.Num();
+				}
+
+				SaveGame->NameTable = SaveNameTable;
+			}
+		}
+		else
+		{
+			OnGameSaved(SaveGame->FlowComponents, SaveGame->FlowInstances);
+		}
 	}
 }
 
+void UFlowSubsystem::RotateSaveNameTableIfStale()
+{
+	// small tables aren't worth writing all data again
+	static constexpr int32 MinNumSaveNamesToRotate = 1024;
+
+	if (SaveNameTable.Num() >= MinNumSaveNamesToRotate && SaveNameTable.Num() > NumSaveNamesInUse * 2)
+	{
+		// data cached by nodes, instances and components is written again, since its format id doesn't match the new table
+		UE_LOG(LogFlow, Verbose, TEXT("Starting new save name table, %d entries written with %d used when the table started"), SaveNameTable.Num(), NumSaveNamesInUse);
+		SaveNameTable = FFlowSaveNameTable();
+		NumSaveNamesInUse = 0;
+	}
+}
+
+bool UFlowSubsystem::AreKeptRecordsUsingOwnNameTable(const UFlowSaveGame& SaveGame) const
+{
+	if (SaveGame.NameTable.IsEmpty())
+	{
+		return false;
+	}
+
+	const FGuid& TableId = SaveGame.NameTable.GetId();
+	const FString WorldName = GetWorld() ? GetWorld()->GetName() : FString();
+
+	// same condition as records removed by OnGameSaved(), as they're written again
+	const auto IsKept = [&WorldName](const FString& RecordWorldName)
+	{
+		return WorldName.IsEmpty() || (!RecordWorldName.IsEmpty() && RecordWorldName != WorldName);
+	};
+
+	for (const FFlowComponentSaveData& Record : SaveGame.FlowComponents)
+	{
+		if (IsKept(Record.WorldName) && FlowSave::IsWrittenWithNameTable(Record.ComponentData, TableId))
+		{
+			return true;
+		}
+	}
+
+	for (const FFlowAssetSaveData& Record : SaveGame.FlowInstances)
+	{
+		if (IsKept(Record.WorldName))
+		{
+			if (FlowSave::IsWrittenWithNameTable(Record.AssetData, TableId))
+			{
+				return true;
+			}
+
+			for (const FFlowNodeSaveData& NodeRecord : Record.NodeRecords)
+			{
+				if (FlowSave::IsWrittenWithNameTable(NodeRecord.NodeData, TableId))
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
 void UFlowSubsystem::OnGameSaved(TArray<FFlowComponentSaveData>& FlowComponents, TArray<FFlowAssetSaveData>& FlowInstances)
 {
+	// saving into the loaded container reorders its records, while their number might stay the same
+	if (LoadedSaveGame && (&FlowComponents == &LoadedSaveGame->FlowComponents || &FlowInstances == &LoadedSaveGame->FlowInstances))
+	{
+		LoadedSaveGameIndex.Reset();
+	}
+
 	// Clear existing data, in case we received data from a reused Save container.
 	// We only remove data for the current world, and Flow Graph instances are not bound to any world.
 	// We keep data bound to other worlds.
@@ -373,21 +684,16 @@ void UFlowSubsystem::OnGameSaved(TArray<FFlowComponentSaveData>& FlowComponents,
 	{
 		const FString& WorldName = GetWorld()->GetName();
 
-		for (int32 i = FlowInstances.Num() - 1; i >= 0; i--)
+		// single pass keeps the order of remaining records, unlike removing records one by one which shifts the array every time
+		FlowInstances.RemoveAll([&WorldName](const FFlowAssetSaveData& Record)
 		{
-			if (FlowInstances[i].WorldName.IsEmpty() || FlowInstances[i].WorldName == WorldName)
-			{
-				FlowInstances.RemoveAt(i);
-			}
-		}
+			return Record.WorldName.IsEmpty() || Record.WorldName == WorldName;
+		});
 
-		for (int32 i = FlowComponents.Num() - 1; i >= 0; i--)
+		FlowComponents.RemoveAll([&WorldName](const FFlowComponentSaveData& Record)
 		{
-			if (FlowComponents[i].WorldName.IsEmpty() || FlowComponents[i].WorldName == WorldName)
-			{
-				FlowComponents.RemoveAt(i);
-			}
-		}
+			return Record.WorldName.IsEmpty() || Record.WorldName == WorldName;
+		});
 	}
 
 	// Save Flow Graphs.
@@ -432,6 +738,10 @@ void UFlowSubsystem::OnGameLoaded(UFlowSaveGame* SaveGame)
 {
 	// Receive a standard Flow Save data container.
 	LoadedSaveGame = SaveGame;
+	if (LoadedSaveGame)
+	{
+		LoadedSaveGameIndex.Build(*LoadedSaveGame, GetLoadedComponentRecords(), GetLoadedAssetRecords());
+	}
 
 	// Here's an opportunity to apply loaded data to custom systems.
 	// Do this by overriding this method in the subclass.
@@ -439,10 +749,122 @@ void UFlowSubsystem::OnGameLoaded(UFlowSaveGame* SaveGame)
 
 void UFlowSubsystem::OnGameLoaded(TArray<FFlowComponentSaveData>& FlowComponents, TArray<FFlowAssetSaveData>& FlowInstances)
 {
+	// Records already stored in the loaded container, i.e. decoded by OnGameLoadedFromData().
+	if (LoadedSaveGame && &FlowComponents == &LoadedSaveGame->FlowComponents && &FlowInstances == &LoadedSaveGame->FlowInstances)
+	{
+		LoadedSaveGameIndex.Build(*LoadedSaveGame);
+		return;
+	}
+
 	// Create an object to store Flow Save data loaded from the custom data container. 
 	LoadedSaveGame = NewObject<UFlowSaveGame>(GetTransientPackage(), UFlowSaveGame::StaticClass());
 	LoadedSaveGame->FlowComponents = FlowComponents;
 	LoadedSaveGame->FlowInstances = FlowInstances;
+	LoadedSaveGameIndex.Build(*LoadedSaveGame);
+}
+
+void UFlowSubsystem::OnGameSavedAsync(UFlowSaveGame* SaveGame, FFlowSaveEncodedDelegate OnCompleted)
+{
+	const TSharedRef<FFlowSaveSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FFlowSaveSnapshot, ESPMode::ThreadSafe>();
+	{
+		// only this part stalls the game thread, including serialization of every saved object
+		SCOPE_CYCLE_COUNTER(STAT_FlowCaptureSave);
+		const double CaptureStartTime = FPlatformTime::Seconds();
+
+		if (SaveGame)
+		{
+			OnGameSaved(SaveGame);
+
+			// records are lent to the worker instead of copied, and returned to the container once encoded
+			Snapshot->FlowComponents = MoveTemp(SaveGame->FlowComponents);
+			Snapshot->FlowInstances = MoveTemp(SaveGame->FlowInstances);
+			Snapshot->NameTable = MoveTemp(SaveGame->NameTable);
+			LentSaveRecords.Add(SaveGame, Snapshot);
+		}
+		else
+		{
+			OnGameSaved(Snapshot->FlowComponents, Snapshot->FlowInstances);
+		}
+
+		UE_LOG(LogFlow, Verbose, TEXT("Captured %d component and %d Flow Asset records on the game thread in %.2f ms"),
+			Snapshot->FlowComponents.Num(), Snapshot->FlowInstances.Num(), (FPlatformTime::Seconds() - CaptureStartTime) * 1000.0);
+	}
+
+	FFlowSaveSerializer::EncodeAsync(Snapshot, FFlowSaveEncodedDelegate::CreateLambda(
+		[WeakThis = TWeakObjectPtr<UFlowSubsystem>(this), SaveGameKey = TObjectKey<UFlowSaveGame>(SaveGame), Snapshot, OnCompleted = MoveTemp(OnCompleted)](const bool bSuccess, const TArray<uint8>& EncodedData)
+		{
+			if (UFlowSubsystem* FlowSubsystem = WeakThis.Get())
+			{
+				FlowSubsystem->ReturnLentSaveRecords(SaveGameKey, Snapshot);
+			}
+
+			OnCompleted.ExecuteIfBound(bSuccess, EncodedData);
+		}));
+}
+
+const FFlowSaveSnapshot* UFlowSubsystem::FindLentSaveRecords(const UFlowSaveGame& SaveGame) const
+{
+	const TSharedRef<FFlowSaveSnapshot, ESPMode::ThreadSafe>* Snapshot = LentSaveRecords.Find(&SaveGame);
+	return Snapshot ? &Snapshot->Get() : nullptr;
+}
+
+void UFlowSubsystem::ReclaimLentSaveRecords(UFlowSaveGame& SaveGame)
+{
+	if (const FFlowSaveSnapshot* Snapshot = FindLentSaveRecords(SaveGame))
+	{
+		// worker might still read the snapshot, so records are copied, not moved
+		// only happens if the container is saved into again before encoding completes
+		if (SaveGame.FlowComponents.IsEmpty() && SaveGame.FlowInstances.IsEmpty())
+		{
+			SaveGame.FlowComponents = Snapshot->FlowComponents;
+			SaveGame.FlowInstances = Snapshot->FlowInstances;
+			SaveGame.NameTable = Snapshot->NameTable;
+		}
+
+		LentSaveRecords.Remove(&SaveGame);
+	}
+}
+
+void UFlowSubsystem::ReturnLentSaveRecords(const TObjectKey<UFlowSaveGame> SaveGameKey, const TSharedRef<FFlowSaveSnapshot, ESPMode::ThreadSafe>& Snapshot)
+{
+	// records reclaimed already, if the container was saved into again
+	const TSharedRef<FFlowSaveSnapshot, ESPMode::ThreadSafe>* LentSnapshot = LentSaveRecords.Find(SaveGameKey);
+	if (LentSnapshot == nullptr || &LentSnapshot->Get() != &Snapshot.Get())
+	{
+		return;
+	}
+
+	LentSaveRecords.Remove(SaveGameKey);
+
+	// worker released the snapshot, so records can be moved now
+	// index of the loaded save game stays valid, as it was built over the same records
+	UFlowSaveGame* SaveGame = SaveGameKey.ResolveObjectPtr();
+	if (SaveGame && SaveGame->FlowComponents.IsEmpty() && SaveGame->FlowInstances.IsEmpty())
+	{
+		SaveGame->FlowComponents = MoveTemp(Snapshot->FlowComponents);
+		SaveGame->FlowInstances = MoveTemp(Snapshot->FlowInstances);
+		SaveGame->NameTable = MoveTemp(Snapshot->NameTable);
+	}
+}
+
+bool UFlowSubsystem::OnGameLoadedFromData(const TArray<uint8>& EncodedData)
+{
+	FFlowSaveSnapshot Snapshot;
+	if (!FFlowSaveSerializer::Decode(EncodedData, Snapshot))
+	{
+		UE_LOG(LogFlow, Error, TEXT("Failed to decode Flow save data"));
+		return false;
+	}
+
+	// decoded records and their name table are moved into the container before OnGameLoaded() runs, so an override can read compact records
+	LoadedSaveGame = NewObject<UFlowSaveGame>(GetTransientPackage(), UFlowSaveGame::StaticClass());
+	LoadedSaveGame->FlowComponents = MoveTemp(Snapshot.FlowComponents);
+	LoadedSaveGame->FlowInstances = MoveTemp(Snapshot.FlowInstances);
+	LoadedSaveGame->NameTable = MoveTemp(Snapshot.NameTable);
+	LoadedSaveGameIndex.Reset();
+
+	OnGameLoaded(LoadedSaveGame->FlowComponents, LoadedSaveGame->FlowInstances);
+	return true;
 }
 
 void UFlowSubsystem::LoadRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const FString& SavedAssetInstanceName, const bool bAllowMultipleInstances)
@@ -481,20 +903,47 @@ void UFlowSubsystem::LoadSubFlow(UFlowNode_SubGraph* SubGraphNode, const FString
 	}
 }
 
+const FFlowSaveGameIndex& UFlowSubsystem::GetLoadedSaveGameIndex() const
+{
+	if (!LoadedSaveGameIndex.IsUpToDate(*LoadedSaveGame, GetLoadedComponentRecords(), GetLoadedAssetRecords()))
+	{
+		LoadedSaveGameIndex.Build(*LoadedSaveGame, GetLoadedComponentRecords(), GetLoadedAssetRecords());
+	}
+
+	return LoadedSaveGameIndex;
+}
+
+const TArray<FFlowComponentSaveData>& UFlowSubsystem::GetLoadedComponentRecords() const
+{
+	const FFlowSaveSnapshot* LentRecords = FindLentSaveRecords(*LoadedSaveGame);
+	return LentRecords ? LentRecords->FlowComponents : LoadedSaveGame->FlowComponents;
+}
+
+const TArray<FFlowAssetSaveData>& UFlowSubsystem::GetLoadedAssetRecords() const
+{
+	const FFlowSaveSnapshot* LentRecords = FindLentSaveRecords(*LoadedSaveGame);
+	return LentRecords ? LentRecords->FlowInstances : LoadedSaveGame->FlowInstances;
+}
+
+const FFlowSaveNameTable* UFlowSubsystem::GetLoadedSaveNameTable() const
+{
+	if (LoadedSaveGame)
+	{
+		const FFlowSaveSnapshot* LentRecords = FindLentSaveRecords(*LoadedSaveGame);
+		return LentRecords ? &LentRecords->NameTable : &LoadedSaveGame->NameTable;
+	}
+
+	return nullptr;
+}
+
 const FFlowComponentSaveData* UFlowSubsystem::GetLoadedComponentRecord(const UFlowComponent* Component) const
 {
 	if (LoadedSaveGame)
 	{
 		const FString WorldName = Component->GetWorld()->GetName();
 		const FString ActorName = Component->GetOwner()->GetName();
-		
-		for (const FFlowComponentSaveData& ComponentRecord : LoadedSaveGame->FlowComponents)
-		{
-			if (ComponentRecord.WorldName == WorldName && ComponentRecord.ActorInstanceName == ActorName)
-			{
-				return &ComponentRecord;
-			}
-		}
+
+		return GetLoadedSaveGameIndex().FindComponentRecord(GetLoadedComponentRecords(), WorldName, ActorName);
 	}
 
 	return nullptr;
@@ -504,24 +953,117 @@ const FFlowAssetSaveData* UFlowSubsystem::GetLoadedAssetRecord(const UObject* Ow
 {
 	if (LoadedSaveGame)
 	{
-		const FName& WorldName = GetWorld()->GetFName();
+		const FString WorldName = GetWorld()->GetName();
 		const bool bAssetBoundToWorld = Asset->IsBoundToWorld();
-		
-		for (const FFlowAssetSaveData& AssetRecord : LoadedSaveGame->FlowInstances)
+
+		return GetLoadedSaveGameIndex().FindAssetRecord(GetLoadedAssetRecords(), SavedAssetInstanceName, bAssetBoundToWorld ? &WorldName : nullptr);
+	}
+
+	return nullptr;
+}
+
+void UFlowSubsystem::ClearLoadedSaveGame()
+{
+	LoadedSaveGame = nullptr;
+	LoadedSaveGameIndex.Reset();
+}
+
+void UFlowSubsystem::AddToComponentRegistry(const FGameplayTag& Tag, UFlowComponent* Component)
+{
+	FlowComponentRegistry.Emplace(Tag, Component);
+
+	if (Tag.IsValid())
+	{
+		// container includes the tag itself
+		for (const FGameplayTag& ParentTag : Tag.GetGameplayTagParents())
+		{
+			FlowComponentHierarchyRegistry.Emplace(ParentTag, Component);
+		}
+	}
+}
+
+void UFlowSubsystem::RemoveFromComponentRegistry(const FGameplayTag& Tag, UFlowComponent* Component)
+{
+	const int32 NumRemoved = FlowComponentRegistry.Remove(Tag, Component);
+
+	if (Tag.IsValid() && NumRemoved > 0)
+	{
+		// parent tags might be shared with other tags of this component, remove only entries added for this tag
+		const TWeakObjectPtr<UFlowComponent> WeakComponent = Component;
+		for (const FGameplayTag& ParentTag : Tag.GetGameplayTagParents())
 		{
-			if (AssetRecord.InstanceName == SavedAssetInstanceName && (!bAssetBoundToWorld || AssetRecord.WorldName == WorldName))
+			for (int32 i = 0; i < NumRemoved; i++)
 			{
-				return &AssetRecord;
+				FlowComponentHierarchyRegistry.RemoveSingle(ParentTag, WeakComponent);
 			}
 		}
 	}
+}
 
-	return nullptr;
+void UFlowSubsystem::AddComponentObserver(UFlowNode_ComponentObserver* Observer, const FGameplayTagContainer& ObservedTags)
+{
+	RemoveComponentObserver(Observer);
+
+	for (const FGameplayTag& Tag : ObservedTags)
+	{
+		if (Tag.IsValid())
+		{
+			ComponentObserverRegistry.Add(Tag, Observer);
+		}
+	}
+
+	ComponentObserverTags.Add(Observer, ObservedTags);
 }
 
-void UFlowSubsystem::ClearLoadedSaveGame()
+void UFlowSubsystem::RemoveComponentObserver(UFlowNode_ComponentObserver* Observer)
 {
-	LoadedSaveGame = nullptr;
+	const TWeakObjectPtr<UFlowNode_ComponentObserver> WeakObserver = Observer;
+
+	FGameplayTagContainer IndexedTags;
+	if (ComponentObserverTags.RemoveAndCopyValue(WeakObserver, IndexedTags))
+	{
+		for (const FGameplayTag& Tag : IndexedTags)
+		{
+			ComponentObserverRegistry.Remove(Tag, WeakObserver);
+		}
+	}
+}
+
+void UFlowSubsystem::NotifyComponentObservers(const FGameplayTagContainer& AffectedTags, const TFunctionRef<void(UFlowNode_ComponentObserver&)> Notify) const
+{
+	if (ComponentObserverRegistry.Num() == 0)
+	{
+		return;
+	}
+
+	// observers might start or stop observing while handling the event, so collect them first
+	// observer indexed under several matching tags is notified once, in the order of first match
+	TArray<TWeakObjectPtr<UFlowNode_ComponentObserver>, TInlineAllocator<16>> Observers;
+	TSet<TWeakObjectPtr<UFlowNode_ComponentObserver>, DefaultKeyFuncs<TWeakObjectPtr<UFlowNode_ComponentObserver>>, TInlineSetAllocator<16>> CollectedObservers;
+	for (const FGameplayTag& AffectedTag : AffectedTags)
+	{
+		// observers using non-exact match are interested in components with child tags
+		for (FGameplayTag Tag = AffectedTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+		{
+			for (TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowNode_ComponentObserver>>::TConstKeyIterator It = ComponentObserverRegistry.CreateConstKeyIterator(Tag); It; ++It)
+			{
+				bool bAlreadyCollected = false;
+				CollectedObservers.Add(It.Value(), &bAlreadyCollected);
+				if (!bAlreadyCollected)
+				{
+					Observers.Add(It.Value());
+				}
+			}
+		}
+	}
+
+	for (const TWeakObjectPtr<UFlowNode_ComponentObserver>& Observer : Observers)
+	{
+		if (Observer.IsValid())
+		{
+			Notify(*Observer.Get());
+		}
+	}
 }
 
 void UFlowSubsystem::RegisterComponent(UFlowComponent* Component)
@@ -530,24 +1072,37 @@ void UFlowSubsystem::RegisterComponent(UFlowComponent* Component)
 	{
 		if (Tag.IsValid())
 		{
-			FlowComponentRegistry.Emplace(Tag, Component);
+			AddToComponentRegistry(Tag, Component);
 		}
 	}
 
+	NotifyComponentObservers(Component->IdentityTags, [Component](UFlowNode_ComponentObserver& Observer)
+	{
+		Observer.OnComponentRegistered(Component);
+	});
 	OnComponentRegistered.Broadcast(Component);
 }
 
 void UFlowSubsystem::OnIdentityTagAdded(UFlowComponent* Component, const FGameplayTag& AddedTag)
 {
-	FlowComponentRegistry.Emplace(AddedTag, Component);
+	AddToComponentRegistry(AddedTag, Component);
 
 	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
 	if (Component->IdentityTags.Num() > 1)
 	{
-		OnComponentTagAdded.Broadcast(Component, FGameplayTagContainer(AddedTag));
+		const FGameplayTagContainer AddedTags(AddedTag);
+		NotifyComponentObservers(Component->IdentityTags, [Component, &AddedTags](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentTagAdded(Component, AddedTags);
+		});
+		OnComponentTagAdded.Broadcast(Component, AddedTags);
 	}
 	else
 	{
+		NotifyComponentObservers(Component->IdentityTags, [Component](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentRegistered(Component);
+		});
 		OnComponentRegistered.Broadcast(Component);
 	}
 }
@@ -556,16 +1111,24 @@ void UFlowSubsystem::OnIdentityTagsAdded(UFlowComponent* Component, const FGamep
 {
 	for (const FGameplayTag& Tag : AddedTags)
 	{
-		FlowComponentRegistry.Emplace(Tag, Component);
+		AddToComponentRegistry(Tag, Component);
 	}
 
 	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
 	if (Component->IdentityTags.Num() > AddedTags.Num())
 	{
+		NotifyComponentObservers(Component->IdentityTags, [Component, &AddedTags](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentTagAdded(Component, AddedTags);
+		});
 		OnComponentTagAdded.Broadcast(Component, AddedTags);
 	}
 	else
 	{
+		NotifyComponentObservers(Component->IdentityTags, [Component](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentRegistered(Component);
+		});
 		OnComponentRegistered.Broadcast(Component);
 	}
 }
@@ -576,24 +1139,39 @@ void UFlowSubsystem::UnregisterComponent(UFlowComponent* Component)
 	{
 		if (Tag.IsValid())
 		{
-			FlowComponentRegistry.Remove(Tag, Component);
+			RemoveFromComponentRegistry(Tag, Component);
 		}
 	}
 
+	NotifyComponentObservers(Component->IdentityTags, [Component](UFlowNode_ComponentObserver& Observer)
+	{
+		Observer.OnComponentUnregistered(Component);
+	});
 	OnComponentUnregistered.Broadcast(Component);
 }
 
 void UFlowSubsystem::OnIdentityTagRemoved(UFlowComponent* Component, const FGameplayTag& RemovedTag)
 {
-	FlowComponentRegistry.Remove(RemovedTag, Component);
+	RemoveFromComponentRegistry(RemovedTag, Component);
+
+	// only observers interested in the removed tag might stop matching the component
+	const FGameplayTagContainer RemovedTags(RemovedTag);
 
 	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
 	if (Component->IdentityTags.Num() > 0)
 	{
-		OnComponentTagRemoved.Broadcast(Component, FGameplayTagContainer(RemovedTag));
+		NotifyComponentObservers(RemovedTags, [Component, &RemovedTags](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentTagRemoved(Component, RemovedTags);
+		});
+		OnComponentTagRemoved.Broadcast(Component, RemovedTags);
 	}
 	else
 	{
+		NotifyComponentObservers(RemovedTags, [Component](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentUnregistered(Component);
+		});
 		OnComponentUnregistered.Broadcast(Component);
 	}
 }
@@ -602,171 +1180,212 @@ void UFlowSubsystem::OnIdentityTagsRemoved(UFlowComponent* Component, const FGam
 {
 	for (const FGameplayTag& Tag : RemovedTags)
 	{
-		FlowComponentRegistry.Remove(Tag, Component);
+		RemoveFromComponentRegistry(Tag, Component);
 	}
 
 	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
 	if (Component->IdentityTags.Num() > 0)
 	{
+		// only observers interested in removed tags might stop matching the component
+		NotifyComponentObservers(RemovedTags, [Component, &RemovedTags](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentTagRemoved(Component, RemovedTags);
+		});
 		OnComponentTagRemoved.Broadcast(Component, RemovedTags);
 	}
 	else
 	{
+		NotifyComponentObservers(RemovedTags, [Component](UFlowNode_ComponentObserver& Observer)
+		{
+			Observer.OnComponentUnregistered(Component);
+		});
 		OnComponentUnregistered.Broadcast(Component);
 	}
 }
 
 TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
-
 	TSet<UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	VisitComponents(Tag, bExactMatch, [&](UFlowComponent& Component)
 	{
-		if (Component.IsValid() && Component->GetClass()->IsChildOf(ComponentClass))
+		if (Component.GetClass()->IsChildOf(ComponentClass))
 		{
-			Result.Emplace(Component.Get());
+			Result.Emplace(&Component);
 		}
-	}
+		return true;
+	});
 
 	return Result;
 }
 
 TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
 {
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 	TSet<UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	VisitComponents(Tags, MatchType, bExactMatch, [&](UFlowComponent& Component)
 	{
-		if (Component.IsValid() && Component->GetClass()->IsChildOf(ComponentClass))
+		if (Component.GetClass()->IsChildOf(ComponentClass))
 		{
-			Result.Emplace(Component.Get());
+			Result.Emplace(&Component);
 		}
-	}
+		return true;
+	});
 
 	return Result;
 }
 
 TSet<AActor*> UFlowSubsystem::GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
-
 	TSet<AActor*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	VisitComponents(Tag, bExactMatch, [&](UFlowComponent& Component)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (Component.GetOwner()->GetClass()->IsChildOf(ActorClass))
 		{
-			Result.Emplace(Component->GetOwner());
+			Result.Emplace(Component.GetOwner());
 		}
-	}
+		return true;
+	});
 
 	return Result;
 }
 
 TSet<AActor*> UFlowSubsystem::GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
 {
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 	TSet<AActor*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	VisitComponents(Tags, MatchType, bExactMatch, [&](UFlowComponent& Component)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (Component.GetOwner()->GetClass()->IsChildOf(ActorClass))
 		{
-			Result.Emplace(Component->GetOwner());
+			Result.Emplace(Component.GetOwner());
 		}
-	}
+		return true;
+	});
 
 	return Result;
 }
 
 TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
-
 	TMap<AActor*, UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	VisitComponents(Tag, bExactMatch, [&](UFlowComponent& Component)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (Component.GetOwner()->GetClass()->IsChildOf(ActorClass))
 		{
-			Result.Emplace(Component->GetOwner(), Component.Get());
+			Result.Emplace(Component.GetOwner(), &Component);
 		}
-	}
+		return true;
+	});
 
 	return Result;
 }
 
 TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
 {
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 	TMap<AActor*, UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	VisitComponents(Tags, MatchType, bExactMatch, [&](UFlowComponent& Component)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (Component.GetOwner()->GetClass()->IsChildOf(ActorClass))
 		{
-			Result.Emplace(Component->GetOwner(), Component.Get());
+			Result.Emplace(Component.GetOwner(), &Component);
 		}
-	}
+		return true;
+	});
 
 	return Result;
 }
 
-void UFlowSubsystem::FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+namespace FlowComponentQuery
 {
-	if (bExactMatch)
+	typedef TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>> FRegistry;
+	typedef TSet<const UFlowComponent*, DefaultKeyFuncs<const UFlowComponent*>, TInlineSetAllocator<16>> FVisitedComponents;
+
+	/* Visits every valid component registered under given tag, skipping components already visited or rejected by the filter.
+	 * Component might be registered multiple times under the same key, i.e. under several tags sharing a parent tag.
+	 * Visited components are tracked, as their current Identity Tags don't have to match the registry state. */
+	template <typename FilterT>
+	bool VisitRegistryKey(const FRegistry& Registry, const FGameplayTag& Tag, const FilterT& Filter, FVisitedComponents& VisitedComponents, TFunctionRef<bool(UFlowComponent&)> Visitor)
 	{
-		FlowComponentRegistry.MultiFind(Tag, OutComponents);
-	}
-	else
-	{
-		for (TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>>::TConstIterator It(FlowComponentRegistry); It; ++It)
+		for (FRegistry::TConstKeyIterator It = Registry.CreateConstKeyIterator(Tag); It; ++It)
 		{
-			if (It.Key().MatchesTag(Tag))
+			UFlowComponent* Component = It.Value().Get();
+			if (Component == nullptr || !Filter(*Component))
+			{
+				continue;
+			}
+
+			bool bAlreadyVisited = false;
+			VisitedComponents.Add(Component, &bAlreadyVisited);
+			if (bAlreadyVisited)
 			{
-				OutComponents.Emplace(It.Value());
+				continue;
+			}
+
+			if (!Visitor(*Component))
+			{
+				return false;
 			}
 		}
+
+		return true;
+	}
+}
+
+bool UFlowSubsystem::VisitComponents(const FGameplayTag& Tag, const bool bExactMatch, const FComponentVisitor Visitor) const
+{
+	if (!Tag.IsValid())
+	{
+		return true;
 	}
+
+	// non-exact query is the same as checking MatchesTag on every registry entry, as entries are indexed by all parents of their tags
+	const FlowComponentQuery::FRegistry& Registry = bExactMatch ? FlowComponentRegistry : FlowComponentHierarchyRegistry;
+	FlowComponentQuery::FVisitedComponents VisitedComponents;
+	return FlowComponentQuery::VisitRegistryKey(Registry, Tag, [](const UFlowComponent&) { return true; }, VisitedComponents, Visitor);
 }
 
-void UFlowSubsystem::FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+bool UFlowSubsystem::VisitComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, const FComponentVisitor Visitor) const
 {
+	const FlowComponentQuery::FRegistry& Registry = bExactMatch ? FlowComponentRegistry : FlowComponentHierarchyRegistry;
+	FlowComponentQuery::FVisitedComponents VisitedComponents;
+
 	if (MatchType == EGameplayContainerMatchType::Any)
 	{
+		// component matching several tags is visited only for the first of them
 		for (const FGameplayTag& Tag : Tags)
 		{
-			TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
-			FindComponents(Tag, bExactMatch, ComponentsPerTag);
-			OutComponents.Append(ComponentsPerTag);
+			if (Tag.IsValid() && !FlowComponentQuery::VisitRegistryKey(Registry, Tag, [](const UFlowComponent&) { return true; }, VisitedComponents, Visitor))
+			{
+				return false;
+			}
 		}
+
+		return true;
 	}
-	else // EGameplayContainerMatchType::All
+
+	// EGameplayContainerMatchType::All
+	// every result has to match all tags, so it's enough to check candidates for the least common tag
+	const FGameplayTag* LeastCommonTag = nullptr;
+	int32 LeastCommonTagNum = MAX_int32;
+	for (const FGameplayTag& Tag : Tags)
 	{
-		TSet<TWeakObjectPtr<UFlowComponent>> ComponentsWithAnyTag;
-		for (const FGameplayTag& Tag : Tags)
+		const int32 TagNum = Registry.Num(Tag);
+		if (TagNum < LeastCommonTagNum)
 		{
-			TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
-			FindComponents(Tag, bExactMatch, ComponentsPerTag);
-			ComponentsWithAnyTag.Append(ComponentsPerTag);
-			break;
+			LeastCommonTag = &Tag;
+			LeastCommonTagNum = TagNum;
 		}
+	}
 
-		for (const TWeakObjectPtr<UFlowComponent>& Component : ComponentsWithAnyTag)
-		{
-			if (Component.IsValid() && 
-				(bExactMatch ? Component->IdentityTags.HasAllExact(Tags) : Component->IdentityTags.HasAll(Tags)))
-			{
-				OutComponents.Emplace(Component);
-			}
-		}
+	if (LeastCommonTag == nullptr || LeastCommonTagNum == 0)
+	{
+		return true;
 	}
+
+	const auto HasAllTags = [&Tags, bExactMatch](const UFlowComponent& Component)
+	{
+		return bExactMatch ? Component.IdentityTags.HasAllExact(Tags) : Component.IdentityTags.HasAll(Tags);
+	};
+
+	return FlowComponentQuery::VisitRegistryKey(Registry, *LeastCommonTag, HasAllTags, VisitedComponents, Visitor);
 }
 
 #undef LOCTEXT_NAMESPACE
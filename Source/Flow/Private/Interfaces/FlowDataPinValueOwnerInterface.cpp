@@ -5,6 +5,10 @@
 #include "Types/FlowAutoDataPinsWorkingData.h"
 #include "Types/FlowNamedDataPinProperty.h"
 
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+
 #if WITH_EDITOR
 void IFlowDataPinValueOwnerInterface::AutoGenerateDataPins(FFlowDataPinValueOwner& ValueOwner, FFlowAutoDataPinsWorkingData& InOutWorkingData)
 {
@@ -39,20 +43,16 @@ bool IFlowDataPinValueOwnerInterface::TryFindPropertyByPinName_Static(const UObj
 	// First check if the PinName matches a NamedProperties array name
 	if (const IFlowNamedPropertiesSupplierInterface* NamedPropertySupplier = Cast<IFlowNamedPropertiesSupplierInterface>(&PropertyOwnerObject))
 	{
-		const TArray<FFlowNamedDataPinProperty>& NamedProperties = NamedPropertySupplier->GetNamedProperties();
-		for (const FFlowNamedDataPinProperty& NamedProperty : NamedProperties)
+		if (const FFlowNamedDataPinProperty* NamedProperty = NamedPropertySupplier->FindNamedProperty(PinName))
 		{
-			if (NamedProperty.Name == PinName && NamedProperty.IsValid())
-			{
-				OutFoundInstancedStruct = NamedProperty.DataPinValue;
+			OutFoundInstancedStruct = NamedProperty->DataPinValue;
 
-				return true;
-			}
+			return true;
 		}
 	}
 
 	// Try direct property match
-	OutFoundProperty = PropertyOwnerObject.GetClass()->FindPropertyByName(PinName);
+	OutFoundProperty = FindPropertyByNameCached(*PropertyOwnerObject.GetClass(), PinName);
 	if (OutFoundProperty)
 	{
 		const FStructProperty* StructProperty = CastField<FStructProperty>(OutFoundProperty);
@@ -71,4 +71,118 @@ bool IFlowDataPinValueOwnerInterface::TryFindPropertyByPinName_Static(const UObj
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+bool IFlowDataPinValueOwnerInterface::TryFindPropertyViewByPinName(
+	const FName& PinName,
+	const FProperty*& OutFoundProperty,
+	const FFlowDataPinValue*& OutFoundValue) const
+{
+	const UObject* ThisAsObject = Cast<UObject>(this);
+	return TryFindPropertyViewByPinName_Static(*ThisAsObject, PinName, OutFoundProperty, OutFoundValue);
+}
+
+bool IFlowDataPinValueOwnerInterface::TryFindPropertyViewByPinName_Static(const UObject& PropertyOwnerObject, const FName& PinName, const FProperty*& OutFoundProperty, const FFlowDataPinValue*& OutFoundValue)
+{
+	// Same lookup order as TryFindPropertyByPinName_Static
+	if (const IFlowNamedPropertiesSupplierInterface* NamedPropertySupplier = Cast<IFlowNamedPropertiesSupplierInterface>(&PropertyOwnerObject))
+	{
+		if (const FFlowNamedDataPinProperty* NamedProperty = NamedPropertySupplier->FindNamedProperty(PinName))
+		{
+			OutFoundValue = NamedProperty->DataPinValue.GetPtr();
+
+			return true;
+		}
+	}
+
+	// Wrapper struct properties are viewed through the property as well
+	OutFoundProperty = FindPropertyByNameCached(*PropertyOwnerObject.GetClass(), PinName);
+	return OutFoundProperty != nullptr;
+}
+
+namespace FlowDataPinPropertyTable
+{
+	/* Every property of a class by name, including inherited ones. */
+	struct FClassTable
+	{
+		/* Layout the table has been built for. Recompiled or relinked class gets new properties, so the table is rebuilt. */
+		const FProperty* PropertyLink = nullptr;
+		int32 PropertiesSize = 0;
+
+		TMap<FName, const FProperty*> Properties;
+
+		bool MatchesLayout(const UClass& Class) const
+		{
+			return PropertyLink == Class.PropertyLink && PropertiesSize == Class.GetPropertiesSize();
+		}
+
+		void Build(const UClass& Class)
+		{
+			PropertyLink = Class.PropertyLink;
+			PropertiesSize = Class.GetPropertiesSize();
+
+			// properties of the class come before properties of its super classes, same as UStruct::FindPropertyByName
+			Properties.Reset();
+			for (TFieldIterator<FProperty> It(&Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+			{
+				if (!Properties.Contains(It->GetFName()))
+				{
+					Properties.Add(It->GetFName(), *It);
+				}
+			}
+		}
+	};
+
+	/* Classes are weakly referenced, so tables of garbage collected classes can be pruned. */
+	static TMap<TWeakObjectPtr<const UClass>, FClassTable> ClassTables;
+
+	static const FClassTable& FindOrBuild(const UClass& Class)
+	{
+		const TWeakObjectPtr<const UClass> ClassKey(&Class);
+		if (FClassTable* ClassTable = ClassTables.Find(ClassKey))
+		{
+			if (!ClassTable->MatchesLayout(Class))
+			{
+				ClassTable->Build(Class);
+			}
+			return *ClassTable;
+		}
+
+		// good moment to drop tables of unloaded classes, i.e. blueprint classes replaced by recompiled ones
+		for (TMap<TWeakObjectPtr<const UClass>, FClassTable>::TIterator It = ClassTables.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		FClassTable& ClassTable = ClassTables.Add(ClassKey);
+		ClassTable.Build(Class);
+		return ClassTable;
+	}
+}
+
+const FProperty* IFlowDataPinValueOwnerInterface::FindPropertyByNameCached(const UClass& Class, const FName& PropertyName)
+{
+	if (!IsInGameThread())
+	{
+		return Class.FindPropertyByName(PropertyName);
+	}
+
+#if WITH_EDITOR
+	static bool bRegisteredReinstancing = false;
+	if (!bRegisteredReinstancing)
+	{
+		// properties of reinstanced classes might be destroyed before the layout check could notice it
+		FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const TMap<UObject*, UObject*>&)
+		{
+			FlowDataPinPropertyTable::ClassTables.Reset();
+		});
+		bRegisteredReinstancing = true;
+	}
+#endif
+
+	const FProperty* const* Property = FlowDataPinPropertyTable::FindOrBuild(Class).Properties.Find(PropertyName);
+	return Property ? *Property : nullptr;
+}
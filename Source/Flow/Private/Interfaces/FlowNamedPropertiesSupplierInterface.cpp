@@ -0,0 +1,19 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Interfaces/FlowNamedPropertiesSupplierInterface.h"
+#include "Types/FlowNamedDataPinProperty.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNamedPropertiesSupplierInterface)
+
+const FFlowNamedDataPinProperty* IFlowNamedPropertiesSupplierInterface::FindNamedProperty(const FName& PropertyName) const
+{
+	for (const FFlowNamedDataPinProperty& NamedProperty : GetNamedProperties())
+	{
+		if (NamedProperty.Name == PropertyName && NamedProperty.IsValid())
+		{
+			return &NamedProperty;
+		}
+	}
+
+	return nullptr;
+}
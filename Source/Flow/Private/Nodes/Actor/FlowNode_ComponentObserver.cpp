@@ -55,8 +55,16 @@ void UFlowNode_ComponentObserver::StartObserving()
 		const bool bExactMatch = (IdentityMatchType == EFlowTagContainerMatchType::HasAnyExact || IdentityMatchType == EFlowTagContainerMatchType::HasAllExact);
 
 		// collect already registered components
-		for (const TWeakObjectPtr<UFlowComponent>& FoundComponent : FlowSubsystem->GetComponents<UFlowComponent>(IdentityTags, ContainerMatchType, bExactMatch))
+		TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> FoundComponents;
+		FlowSubsystem->GatherComponents(IdentityTags, ContainerMatchType, bExactMatch, FoundComponents);
+
+		for (const TWeakObjectPtr<UFlowComponent>& FoundComponent : FoundComponents)
 		{
+			if (!FoundComponent.IsValid())
+			{
+				continue;
+			}
+
 			ObserveActor(FoundComponent->GetOwner(), FoundComponent);
 			
 			// node might finish work immediately as the effect of ObserveActor()
@@ -67,10 +75,8 @@ void UFlowNode_ComponentObserver::StartObserving()
 			}
 		}
 		
-		FlowSubsystem->OnComponentRegistered.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentRegistered);
-		FlowSubsystem->OnComponentTagAdded.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentTagAdded);
-		FlowSubsystem->OnComponentTagRemoved.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentTagRemoved);
-		FlowSubsystem->OnComponentUnregistered.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentUnregistered);
+		// subsystem calls On Component methods only if the change affects our Identity Tags
+		FlowSubsystem->AddComponentObserver(this, IdentityTags);
 	}
 }
 
@@ -78,10 +84,7 @@ void UFlowNode_ComponentObserver::StopObserving()
 {
 	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 	{
-		FlowSubsystem->OnComponentRegistered.RemoveAll(this);
-		FlowSubsystem->OnComponentUnregistered.RemoveAll(this);
-		FlowSubsystem->OnComponentTagAdded.RemoveAll(this);
-		FlowSubsystem->OnComponentTagRemoved.RemoveAll(this);
+		FlowSubsystem->RemoveComponentObserver(this);
 	}
 }
 
@@ -124,6 +127,8 @@ void UFlowNode_ComponentObserver::OnEventReceived()
 	TriggerFirstOutput(false);
 
 	SuccessCount++;
+	MarkSaveDirty();
+
 	if (SuccessLimit > 0 && SuccessCount == SuccessLimit)
 	{
 		TriggerOutput(TEXT("Completed"), true);
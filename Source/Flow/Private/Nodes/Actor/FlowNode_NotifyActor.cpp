@@ -23,9 +23,15 @@ void UFlowNode_NotifyActor::ExecuteInput(const FName& PinName)
 {
 	if (const UFlowSubsystem* FlowSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UFlowSubsystem>())
 	{
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(IdentityTags, MatchType, bExactMatch))
+		TArray<TWeakObjectPtr<UFlowComponent>, TInlineAllocator<8>> Components;
+		FlowSubsystem->GatherComponents(IdentityTags, MatchType, bExactMatch, Components);
+
+		for (const TWeakObjectPtr<UFlowComponent>& Component : Components)
 		{
-			Component->NotifyFromGraph(NotifyTags, NetMode);
+			if (Component.IsValid())
+			{
+				Component->NotifyFromGraph(NotifyTags, NetMode);
+			}
 		}
 	}
 
@@ -6,6 +6,7 @@
 
 UFlowNode_OnActorRegistered::UFlowNode_OnActorRegistered()
 {
+	SaveDataCacheClass = StaticClass();
 }
 
 void UFlowNode_OnActorRegistered::ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component)
@@ -6,6 +6,7 @@
 
 UFlowNode_OnActorUnregistered::UFlowNode_OnActorUnregistered()
 {
+	SaveDataCacheClass = StaticClass();
 }
 
 void UFlowNode_OnActorUnregistered::ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component)
@@ -11,6 +11,8 @@ UFlowNode_OnNotifyFromActor::UFlowNode_OnNotifyFromActor()
 #if WITH_EDITOR
 	NodeDisplayStyle = FlowNodeStyle::Condition;
 #endif
+
+	SaveDataCacheClass = StaticClass();
 }
 
 void UFlowNode_OnNotifyFromActor::ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component)
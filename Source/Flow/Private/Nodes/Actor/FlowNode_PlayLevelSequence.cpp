@@ -22,7 +22,8 @@ FFlowNodeLevelSequenceEvent UFlowNode_PlayLevelSequence::OnPlaybackStarted;
 FFlowNodeLevelSequenceEvent UFlowNode_PlayLevelSequence::OnPlaybackCompleted;
 
 UFlowNode_PlayLevelSequence::UFlowNode_PlayLevelSequence()
-	: bPlayReverse(false)
+	: LoadingMode(EFlowSequenceLoadingMode::LoadSynchronously)
+	, bPlayReverse(false)
 	, bUseGraphOwnerAsTransformOrigin(false)
 	, bReplicates(false)
 	, bAlwaysRelevant(false)
@@ -33,6 +34,11 @@ UFlowNode_PlayLevelSequence::UFlowNode_PlayLevelSequence()
 	, StartTime(0.0f)
 	, ElapsedTime(0.0f)
 	, TimeDilation(1.0f)
+	, PreloadRequestTime(0.0)
+	, bWaitingForSequenceLoad(false)
+	, bPauseWhenStarted(false)
+	, SequenceLoadRequestTime(0.0)
+	, LastLoadLatency(-1.0f)
 {
 #if WITH_EDITOR
 	Category = TEXT("Actor");
@@ -116,10 +122,12 @@ EFlowPreloadResult UFlowNode_PlayLevelSequence::PreloadContent()
 	// Bind a weak delegate so NotifyPreloadComplete() is called when streaming finishes.
 	// If the asset is already cached, RequestAsyncLoad fires the delegate synchronously
 	// (safe — PendingPreloadCount is already set by TriggerPreload before this call).
+	PreloadRequestTime = FPlatformTime::Seconds();
 	PreloadHandle = StreamableManager.RequestAsyncLoad(
 		Sequence.ToSoftObjectPath(),
 		FStreamableDelegate::CreateWeakLambda(this, [this]()
 		{
+			ReportLoadLatency(PreloadRequestTime, TEXT("Preload"));
 			NotifyPreloadComplete();
 		}));
 
@@ -195,32 +203,31 @@ void UFlowNode_PlayLevelSequence::ExecuteInput(const FName& PinName)
 
 	if (PinName == TEXT("Start"))
 	{
-		LoadedSequence = Sequence.LoadSynchronous();
+		if (bWaitingForSequenceLoad)
+		{
+			return;
+		}
 
-		if (GetFlowSubsystem()->GetWorld() && LoadedSequence)
+		if (!Sequence.IsNull() && Sequence.Get() == nullptr)
 		{
-			CreatePlayer();
+			FLOW_ASSERT_ENUM_MAX(EFlowSequenceLoadingMode, 3);
 
-			if (SequencePlayer)
+			switch (LoadingMode)
 			{
-				TriggerOutput(TEXT("PreStart"));
-
-				SequencePlayer->OnFinished.AddDynamic(this, &UFlowNode_PlayLevelSequence::OnPlaybackFinished);
-
-				if (bPlayReverse)
-				{
-					SequencePlayer->PlayReverse();
-				}
-				else
-				{
-					SequencePlayer->Play();
-				}
-
-				TriggerOutput(TEXT("Started"));
+				case EFlowSequenceLoadingMode::DelayStart:
+					RequestSequenceLoad();
+					return;
+				case EFlowSequenceLoadingMode::Skip:
+					LogNote(FString::Printf(TEXT("Skipping playback, sequence %s isn't loaded"), *Sequence.ToString()));
+					TriggerFirstOutput(false);
+					TriggerOutput(TEXT("Completed"), true);
+					return;
+				default:
+					break;
 			}
 		}
 
-		TriggerFirstOutput(false);
+		StartPlayback();
 	}
 	else if (PinName == TEXT("Stop"))
 	{
@@ -228,12 +235,125 @@ void UFlowNode_PlayLevelSequence::ExecuteInput(const FName& PinName)
 	}
 	else if (PinName == TEXT("Pause"))
 	{
-		SequencePlayer->Pause();
+		if (SequencePlayer)
+		{
+			SequencePlayer->Pause();
+		}
+		else if (bWaitingForSequenceLoad)
+		{
+			// player doesn't exist yet while the sequence is streaming in
+			bPauseWhenStarted = true;
+		}
+	}
+	else if (PinName == TEXT("Resume"))
+	{
+		if (SequencePlayer && SequencePlayer->IsPaused())
+		{
+			SequencePlayer->Play();
+		}
+		else if (bWaitingForSequenceLoad)
+		{
+			bPauseWhenStarted = false;
+		}
+	}
+}
+
+void UFlowNode_PlayLevelSequence::StartPlayback()
+{
+	LoadedSequence = Sequence.LoadSynchronous();
+
+	if (GetFlowSubsystem()->GetWorld() && LoadedSequence)
+	{
+		CreatePlayer();
+
+		if (SequencePlayer)
+		{
+			TriggerOutput(TEXT("PreStart"));
+
+			SequencePlayer->OnFinished.AddDynamic(this, &UFlowNode_PlayLevelSequence::OnPlaybackFinished);
+
+			if (bPlayReverse)
+			{
+				SequencePlayer->PlayReverse();
+			}
+			else
+			{
+				SequencePlayer->Play();
+			}
+
+			// Pause received while the sequence was streaming in
+			if (bPauseWhenStarted)
+			{
+				SequencePlayer->Pause();
+			}
+
+			TriggerOutput(TEXT("Started"));
+		}
+	}
+
+	bPauseWhenStarted = false;
+
+	TriggerFirstOutput(false);
+}
+
+void UFlowNode_PlayLevelSequence::RequestSequenceLoad()
+{
+#if ENABLE_VISUAL_LOG
+	UE_VLOG(this, LogFlow, Log, TEXT("Delaying Start until sequence is loaded"));
+#endif
+
+	bWaitingForSequenceLoad = true;
+	SequenceLoadRequestTime = FPlatformTime::Seconds();
+
+	TSharedPtr<FStreamableHandle> LoadHandle = StreamableManager.RequestAsyncLoad(
+		Sequence.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this]()
+		{
+			OnSequenceLoaded();
+		}));
+
+	// delegate might be called immediately, if the sequence got loaded in the meantime
+	if (bWaitingForSequenceLoad)
+	{
+		SequenceLoadHandle = LoadHandle;
 	}
-	else if (PinName == TEXT("Resume") && SequencePlayer->IsPaused())
+}
+
+void UFlowNode_PlayLevelSequence::OnSequenceLoaded()
+{
+	SequenceLoadHandle.Reset();
+	bWaitingForSequenceLoad = false;
+
+	ReportLoadLatency(SequenceLoadRequestTime, TEXT("Delayed Start"));
+
+	if (Sequence.Get() == nullptr)
 	{
-		SequencePlayer->Play();
+		LogError(FString::Printf(TEXT("Failed to load sequence %s"), *Sequence.ToString()));
 	}
+
+	StartPlayback();
+}
+
+void UFlowNode_PlayLevelSequence::CancelSequenceLoad()
+{
+	if (SequenceLoadHandle.IsValid())
+	{
+		SequenceLoadHandle->CancelHandle();
+		SequenceLoadHandle.Reset();
+	}
+
+	bWaitingForSequenceLoad = false;
+	bPauseWhenStarted = false;
+}
+
+void UFlowNode_PlayLevelSequence::ReportLoadLatency(const double RequestTime, const TCHAR* Context)
+{
+	LastLoadLatency = static_cast<float>(FPlatformTime::Seconds() - RequestTime);
+
+	UE_LOG(LogFlow, Verbose, TEXT("%s of sequence %s took %.3f s"), Context, *Sequence.ToString(), LastLoadLatency);
+#if ENABLE_VISUAL_LOG
+	UE_VLOG(this, LogFlow, Log, TEXT("%s of sequence took %.3f s"), Context, LastLoadLatency);
+#endif
 }
 
 void UFlowNode_PlayLevelSequence::OnSave_Implementation()
@@ -246,7 +366,12 @@ void UFlowNode_PlayLevelSequence::OnSave_Implementation()
 
 void UFlowNode_PlayLevelSequence::OnLoad_Implementation()
 {
-	if (ElapsedTime != 0.0f)
+	if (bWaitingForSequenceLoad)
+	{
+		// game has been saved before playback started
+		RequestSequenceLoad();
+	}
+	else if (ElapsedTime != 0.0f)
 	{
 		LoadedSequence = Sequence.LoadSynchronous();
 		if (GetFlowSubsystem()->GetWorld() && LoadedSequence)
@@ -319,6 +444,8 @@ void UFlowNode_PlayLevelSequence::Cleanup()
 		SequencePlayer = nullptr;
 	}
 
+	CancelSequenceLoad();
+
 	LoadedSequence = nullptr;
 	StartTime = 0.0f;
 	ElapsedTime = 0.0f;
@@ -360,6 +487,11 @@ EDataValidationResult UFlowNode_PlayLevelSequence::ValidateNode()
 
 FString UFlowNode_PlayLevelSequence::GetStatusString() const
 {
+	if (bWaitingForSequenceLoad)
+	{
+		return FString::Printf(TEXT("Loading %.*f s"), 2, FPlatformTime::Seconds() - SequenceLoadRequestTime);
+	}
+
 	return GetPlaybackProgress();
 }
 
@@ -23,6 +23,8 @@ UFlowNode_Log::UFlowNode_Log()
 
 	InputPins = { UFlowNode::DefaultInputPin };
 	OutputPins = { UFlowNode::DefaultOutputPin };
+
+	InstancePoolingClass = StaticClass();
 }
 
 void UFlowNode_Log::ExecuteInput(const FName& PinName)
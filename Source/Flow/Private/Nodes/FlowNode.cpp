@@ -5,25 +5,29 @@
 
 #include "FlowAsset.h"
 #include "FlowSettings.h"
+#include "FlowSubsystem.h"
 #include "Interfaces/FlowPreloadableInterface.h"
 #include "Interfaces/FlowNodeWithExternalDataPinSupplierInterface.h"
 #include "Policies/FlowPreloadHelper.h"
 #include "Policies/FlowPreloadPolicy.h"
 #include "Types/FlowAutoDataPinsWorkingData.h"
+#include "Types/FlowDataPinResolveCache.h"
 #include "Types/FlowDataPinValue.h"
 #include "Types/FlowPinConnectionChange.h"
 #include "Types/FlowPinType.h"
+#include "Types/FlowPinTypeTemplates.h"
+#include "Types/FlowSoftReferenceLoading.h"
 
 #include "Components/ActorComponent.h"
 #if WITH_EDITOR
 #include "Editor.h"
 #endif
 
+#include "Engine/AssetManager.h"
 #include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/Actor.h"
 #include "Misc/App.h"
-#include "Serialization/MemoryReader.h"
-#include "Serialization/MemoryWriter.h"
 
 FFlowPin UFlowNode::DefaultInputPin(TEXT("In"));
 FFlowPin UFlowNode::DefaultOutputPin(TEXT("Out"));
@@ -45,6 +49,8 @@ UFlowNode::UFlowNode()
 
 	InputPins = {DefaultInputPin};
 	OutputPins = {DefaultOutputPin};
+
+	ValueSinkNativeClass = StaticClass();
 }
 
 #if WITH_EDITOR
@@ -67,6 +73,17 @@ void UFlowNode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEve
 	}
 }
 
+void UFlowNode::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// transaction restored Connections directly, so harvesting connections won't see any difference
+	if (UFlowAsset* FlowAsset = GetFlowAsset())
+	{
+		FlowAsset->InvalidateExecutionPlan();
+	}
+}
+
 EDataValidationResult UFlowNode::ValidateNode()
 {
 	EDataValidationResult ValidationResult = Super::ValidateNode();
@@ -574,12 +591,52 @@ void UFlowNode::GatherDataPinValueOwnerCollection(FFlowDataPinValueOwnerCollecti
 		});
 }
 
+bool UFlowNode::TrySupplyPendingValueSink(const UObject& PropertyOwnerObject, const FName& PinName, const FFlowPinType& DataPinType, const FName& PropertyName, FFlowDataPinResult& OutSuppliedResult) const
+{
+	FFlowDataPinValueSink* ValueSink = FFlowDataPinValueSink::FindPending(*this, PinName, DataPinType.GetPinTypeName().Name);
+	if (ValueSink == nullptr)
+	{
+		return false;
+	}
+
+	// Blueprint classes can't override TrySupplyDataPin(), so only the native class matters
+	const UClass* NativeClass = GetClass();
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+
+	if (NativeClass == ValueSinkNativeClass && ValueSink->TrySupplyFromOwner(PropertyOwnerObject, PropertyName))
+	{
+		// Value is already in the caller storage, the result only reports the pin was supplied
+		OutSuppliedResult = FFlowDataPinResult(EFlowDataPinResolveResult::Success);
+		return true;
+	}
+
+	return false;
+}
+
 bool UFlowNode::TryGatherPropertyOwnersAndPopulateResult(
 	const FName& PinName,
 	const FFlowPinType& DataPinType,
 	const FFlowPin& FlowPin,
 	FFlowDataPinResult& OutSuppliedResult) const
 {
+	const FFlowPinPropertySource* FlowPropertySource = GetDataPinPropertySources().Find(PinName);
+
+	// Fast path for properties of the node itself, the default value owner at index 0 (GatherDataPinValueOwnerCollection overrides add it by calling Super first)
+	// Gathering the collection is only needed to find other owners, i.e. AddOns
+	if (FlowPropertySource == nullptr || FlowPropertySource->ValueOwnerIndex == 0)
+	{
+		const FName& PropertyNameToLookup = FlowPropertySource ? FlowPropertySource->PropertyName : PinName;
+		if (TrySupplyPendingValueSink(*this, PinName, DataPinType, PropertyNameToLookup, OutSuppliedResult))
+		{
+			return true;
+		}
+
+		return DataPinType.PopulateResult(*this, *this, PropertyNameToLookup, OutSuppliedResult);
+	}
+
 	// Gather all potential UObject instances that might own properties
 	// mapped to data pins on this node (usually the node itself + any referenced objects)
 	FFlowDataPinValueOwnerCollection ValueOwnerCollection; 
@@ -598,35 +655,21 @@ bool UFlowNode::TryGatherPropertyOwnersAndPopulateResult(
 	FName PropertyNameToLookup;
 	const TArray<FFlowDataPinValueOwner>& ValueOwners = ValueOwnerCollection.GetValueOwners();
 
-	// Look up explicit mapping (used for non-default owners or disambiguated pins)
-	if (const FFlowPinPropertySource* FlowPropertySource = MapDataPinNameToPropertySource.Find(PinName))
+	// Explicit mapping to a non-default owner
+	const int32 OwnerIndex = FlowPropertySource->ValueOwnerIndex;
+	if (ValueOwners.IsValidIndex(OwnerIndex))
 	{
-		const int32 OwnerIndex = FlowPropertySource->ValueOwnerIndex;
-
-		if (ValueOwners.IsValidIndex(OwnerIndex))
-		{
-			ValueOwner = &ValueOwners[OwnerIndex];
-			PropertyNameToLookup = FlowPropertySource->PropertyName;
-		}
-		else
-		{
-			// Critical: mapped index is out of bounds → configuration or generation bug
-			LogError(FString::Printf(TEXT("Invalid property owner index %d for pin '%s' on node %s (max %d owners)"),
-				OwnerIndex, *PinName.ToString(), *GetName(), ValueOwners.Num() - 1),
-				EFlowOnScreenMessageType::Temporary);
-
-			return false;
-		}
+		ValueOwner = &ValueOwners[OwnerIndex];
+		PropertyNameToLookup = FlowPropertySource->PropertyName;
 	}
-	else 
+	else
 	{
-		check(!ValueOwners.IsEmpty());
+		// Critical: mapped index is out of bounds → configuration or generation bug
+		LogError(FString::Printf(TEXT("Invalid property owner index %d for pin '%s' on node %s (max %d owners)"),
+			OwnerIndex, *PinName.ToString(), *GetName(), ValueOwners.Num() - 1),
+			EFlowOnScreenMessageType::Temporary);
 
-		// Fallback for unmapped pins → assume default owner (index 0) + pin name == property name
-		ValueOwner = &ValueOwners[0];
-		check(ValueOwner->IsDefaultValueOwner());
-
-		PropertyNameToLookup = PinName;
+		return false;
 	}
 
 	if (!ValueOwner)
@@ -639,6 +682,11 @@ bool UFlowNode::TryGatherPropertyOwnersAndPopulateResult(
 
 	// Populate the value for the pin on the its owner object
 	const UObject* ValueOwnerAsObject = Cast<UObject>(ValueOwner->OwnerInterface);
+	if (TrySupplyPendingValueSink(*ValueOwnerAsObject, PinName, DataPinType, PropertyNameToLookup, OutSuppliedResult))
+	{
+		return true;
+	}
+
 	const UFlowNode& FlowNodeThis = *this;
 	if (DataPinType.PopulateResult(*ValueOwnerAsObject, FlowNodeThis, PropertyNameToLookup, OutSuppliedResult))
 	{
@@ -716,6 +764,147 @@ void UFlowNode::TryAddSupplierDataToArray(FFlowPinValueSupplierData& InOutSuppli
 }
 
 // #FlowDataPinLegacy
+bool UFlowNode::TryDeferInputUntilDataPinsLoaded(const FName& PinName)
+{
+	if (!bDeferInputUntilDataPinsLoaded)
+	{
+		return false;
+	}
+
+	if (DeferredDataPinsLoadHandle.IsValid() || !DeferredInputPinNames.IsEmpty())
+	{
+		// keep the order of inputs, earlier ones are still waiting for their assets
+		DeferredInputPinNames.Add(PinName);
+		MarkSaveDirty();
+		return true;
+	}
+
+	const TArray<FSoftObjectPath> PathsToLoad = GatherUnloadedDataPinPaths(PinName);
+	if (PathsToLoad.IsEmpty())
+	{
+		return false;
+	}
+
+	DeferredInputPinNames.Add(PinName);
+	MarkSaveDirty();
+
+	RequestDeferredDataPinsLoad(PathsToLoad);
+	return true;
+}
+
+void UFlowNode::GetDataPinsReadByInput(const FName& InputPinName, TArray<FName>& OutDataPinNames) const
+{
+	// Connections cache only data input pins and exec output pins
+	for (const TPair<FName, FConnectedPin>& Connection : GetConnections())
+	{
+		if (!OutputPins.Contains(Connection.Key))
+		{
+			OutDataPinNames.Add(Connection.Key);
+		}
+	}
+}
+
+TArray<FSoftObjectPath> UFlowNode::GatherUnloadedDataPinPaths(const FName& InputPinName) const
+{
+	TArray<FName> DataPinNames;
+	GetDataPinsReadByInput(InputPinName, DataPinNames);
+
+	FFlowDeferredLoadScope DeferredLoadScope;
+
+	// pins connected to the same supplier pin are resolved once, the cache is flushed with the end of this pass
+	const FFlowDataPinResolveCacheScope DataPinResolveCache;
+
+	for (const FName& DataPinName : DataPinNames)
+	{
+		const FFlowDataPinResult DataPinResult = TryResolveDataPin(DataPinName);
+
+		// soft paths of the Class wrapper are resolved only while extracting values
+		if (DataPinResult.ResultValue.GetScriptStruct() == FFlowDataPinValue_Class::StaticStruct())
+		{
+			TArray<FFlowPinType_Class::ValueType> Classes;
+			FlowPinType::TryExtractValues<FFlowPinType_Class>(DataPinResult, Classes);
+		}
+	}
+
+	return DeferredLoadScope.GetDeferredPaths();
+}
+
+void UFlowNode::RequestDeferredDataPinsLoad(const TArray<FSoftObjectPath>& PathsToLoad)
+{
+	TSharedPtr<FStreamableHandle> LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(PathsToLoad,
+		FStreamableDelegate::CreateWeakLambda(this, [this]()
+		{
+			OnDeferredDataPinsLoaded();
+		}));
+
+	// streamable manager might call the delegate immediately, then inputs have been already executed
+	if (LoadHandle.IsValid() && !LoadHandle->HasLoadCompleted())
+	{
+		DeferredDataPinsLoadHandle = LoadHandle;
+	}
+}
+
+void UFlowNode::OnDeferredDataPinsLoaded()
+{
+	DeferredDataPinsLoadHandle.Reset();
+
+	// assets of the first input have been just loaded, inputs queued after it might read other pins
+	bool bAssetsRequested = true;
+
+	// executed input might trigger another input, or cleanup the node
+	while (!DeferredInputPinNames.IsEmpty() && !DeferredDataPinsLoadHandle.IsValid())
+	{
+		const FName PinName = DeferredInputPinNames[0];
+
+		if (!bAssetsRequested)
+		{
+			bAssetsRequested = true;
+
+			const TArray<FSoftObjectPath> PathsToLoad = GatherUnloadedDataPinPaths(PinName);
+			if (!PathsToLoad.IsEmpty())
+			{
+				RequestDeferredDataPinsLoad(PathsToLoad);
+				continue;
+			}
+		}
+
+		DeferredInputPinNames.RemoveAt(0, 1, EAllowShrinking::No);
+		MarkSaveDirty();
+
+		ExecuteInputForSelfAndAddOns(PinName);
+		bAssetsRequested = false;
+	}
+}
+
+void UFlowNode::RestoreDeferredInputs()
+{
+	if (DeferredInputPinNames.IsEmpty() || DeferredDataPinsLoadHandle.IsValid())
+	{
+		return;
+	}
+
+	const TArray<FSoftObjectPath> PathsToLoad = GatherUnloadedDataPinPaths(DeferredInputPinNames[0]);
+	if (PathsToLoad.IsEmpty())
+	{
+		OnDeferredDataPinsLoaded();
+	}
+	else
+	{
+		RequestDeferredDataPinsLoad(PathsToLoad);
+	}
+}
+
+void UFlowNode::CancelDeferredDataPinsLoad()
+{
+	if (DeferredDataPinsLoadHandle.IsValid())
+	{
+		DeferredDataPinsLoadHandle->CancelHandle();
+		DeferredDataPinsLoadHandle.Reset();
+	}
+
+	DeferredInputPinNames.Empty();
+}
+
 void UFlowNode::FixupDataPinTypes()
 {
 	FixupDataPinTypesForArray(InputPins);
@@ -872,7 +1061,7 @@ void UFlowNode::SetConnections(const TMap<FName, FConnectedPin>& InConnections)
 TSet<UFlowNode*> UFlowNode::GatherConnectedNodes() const
 {
 	TSet<UFlowNode*> Result;
-	for (const TPair<FName, FConnectedPin>& Connection : Connections)
+	for (const TPair<FName, FConnectedPin>& Connection : GetConnections())
 	{
 		Result.Emplace(GetFlowAsset()->GetNode(Connection.Value.NodeGuid));
 	}
@@ -882,7 +1071,7 @@ TSet<UFlowNode*> UFlowNode::GatherConnectedNodes() const
 
 FName UFlowNode::GetPinConnectedToNode(const FGuid& OtherNodeGuid)
 {
-	for (const TPair<FName, FConnectedPin>& Connection : Connections)
+	for (const TPair<FName, FConnectedPin>& Connection : GetConnections())
 	{
 		if (Connection.Value.NodeGuid == OtherNodeGuid)
 		{
@@ -1091,7 +1280,7 @@ bool UFlowNode::FindConnectedNodeForPinCached(const FName& FlowPinName, FConnect
 	// - data input pins
 	// In both cases, there must be only one connection (due to schema rules in Flow).
 	// For the opposite direction (exec inputs, data outputs, the uncached version must be used.
-	const FConnectedPin* FoundConnectedPin = Connections.Find(FlowPinName);
+	const FConnectedPin* FoundConnectedPin = GetConnections().Find(FlowPinName);
 	if (FoundConnectedPin)
 	{
 		ConnectedPin = *FoundConnectedPin;
@@ -1113,40 +1302,16 @@ bool UFlowNode::FindConnectedNodeForPinUncached(const FName& PinName, TArray<FCo
 
 	check(!ConnectedPins || ConnectedPins->IsEmpty());
 
-	for (const TPair<FGuid, UFlowNode*>& Pair : ObjectPtrDecay(FlowAsset->Nodes))
-	{
-		const UFlowNode* ConnectedFromFlowNode = Pair.Value;
-
-		if (!IsValid(ConnectedFromFlowNode))
-		{
-			continue;
-		}
+	// These connections aren't cached on this node, but the asset keeps a reverse index of connections cached by other nodes
+	const TSharedRef<const FFlowExecutionPlan> Plan = FlowAsset->GetOrBuildExecutionPlan();
+	const TConstArrayView<FConnectedPin> IncomingConnections = Plan->GetIncomingConnections(FConnectedPin(NodeGuid, PinName));
 
-		for (const TPair<FName, FConnectedPin>& Connection : ConnectedFromFlowNode->Connections)
-		{
-			const FConnectedPin& ConnectedPinStruct = Connection.Value;
-
-			if (ConnectedPinStruct.NodeGuid == NodeGuid && ConnectedPinStruct.PinName == PinName)
-			{
-				if (ConnectedPins)
-				{
-					ConnectedPins->Add(ConnectedPinStruct);
-				}
-				else
-				{
-					// Early return if not collecting the ConnectedPins, since only connected true/false matters
-					return true;
-				}
-			}
-		}
-	}
-
-	if (ConnectedPins && !ConnectedPins->IsEmpty())
+	if (ConnectedPins)
 	{
-		return true;
+		ConnectedPins->Append(IncomingConnections);
 	}
 
-	return false;
+	return IncomingConnections.Num() > 0;
 }
 
 TArray<FConnectedPin> UFlowNode::GetKnownConnectionsToPin(const FConnectedPin& Pin) const
@@ -1155,7 +1320,7 @@ TArray<FConnectedPin> UFlowNode::GetKnownConnectionsToPin(const FConnectedPin& P
 
 	if (Pin.NodeGuid == NodeGuid)
 	{
-		const FConnectedPin& Connection = Connections.FindRef(Pin.PinName);
+		const FConnectedPin& Connection = GetConnections().FindRef(Pin.PinName);
 		if (Connection.NodeGuid.IsValid())
 		{
 			ConnectedPins.Add(Connection);
@@ -1163,7 +1328,7 @@ TArray<FConnectedPin> UFlowNode::GetKnownConnectionsToPin(const FConnectedPin& P
 	}
 	else
 	{
-		for (const TPair<FName, FConnectedPin>& Connection : Connections)
+		for (const TPair<FName, FConnectedPin>& Connection : GetConnections())
 		{
 			if (Connection.Value.NodeGuid == Pin.NodeGuid && Connection.Value.PinName == Pin.PinName)
 			{
@@ -1207,11 +1372,21 @@ void UFlowNode::InitializeInstance()
 
 void UFlowNode::DeinitializeInstance()
 {
+	CancelDeferredDataPinsLoad();
 	DeinitializePreloadHelper();
 
+	bSaveDirty = true;
+	CachedSaveData.Empty();
+	CachedSaveFormatId.Invalidate();
+
 	Super::DeinitializeInstance();
 }
 
+bool UFlowNode::CanBeReusedByInstancePool() const
+{
+	return (bSupportsInstancePooling || (InstancePoolingClass && GetClass() == InstancePoolingClass)) && AddOns.IsEmpty();
+}
+
 void UFlowNode::OnActivate()
 {
 	Super::OnActivate();
@@ -1224,6 +1399,8 @@ void UFlowNode::OnActivate()
 
 void UFlowNode::Cleanup()
 {
+	CancelDeferredDataPinsLoad();
+
 	if (FFlowPreloadHelper* Helper = PreloadHelper.GetMutablePtr())
 	{
 		Helper->OnNodeCleanup(*this);
@@ -1364,6 +1541,8 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 
 	if (InputPins.Contains(PinName))
 	{
+		MarkSaveDirty();
+
 		if (SignalMode == EFlowSignalMode::Enabled)
 		{
 			const EFlowNodeState PreviousActivationState = ActivationState;
@@ -1378,6 +1557,10 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 #if !UE_BUILD_SHIPPING
 		// record for debugging
 		TArray<FPinRecord>& Records = InputRecords.FindOrAdd(PinName);
+		if (Records.Num() >= FPinRecord::MaxRecordsPerPin)
+		{
+			Records.RemoveAt(0, 1, EAllowShrinking::No);
+		}
 		Records.Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
 
 		if (const UFlowAsset* FlowAssetTemplate = GetFlowAsset()->GetTemplateAsset())
@@ -1397,7 +1580,10 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 	switch (SignalMode)
 	{
 		case EFlowSignalMode::Enabled:
-			ExecuteInputForSelfAndAddOns(PinName);
+			if (!TryDeferInputUntilDataPinsLoaded(PinName))
+			{
+				ExecuteInputForSelfAndAddOns(PinName);
+			}
 			break;
 		case EFlowSignalMode::Disabled:
 			if (GetDefault<UFlowSettings>()->bLogOnSignalDisabled)
@@ -1433,17 +1619,28 @@ void UFlowNode::TriggerOutput(const FName PinName, const bool bFinish /*= false*
 		return;
 	}
 
+	// downstream nodes shouldn't read values memoized by this node, and might change values supplied to data pins
+	const FFlowDataPinResolveCacheSuspendScope DataPinResolveCacheSuspension;
+
+	MarkSaveDirty();
+
 	// clean up node, if needed
 	if (bFinish)
 	{
 		Finish();
 	}
 
+	const int32 OutputPinIndex = OutputPins.IndexOfByKey(PinName);
+
 #if !UE_BUILD_SHIPPING
-	if (OutputPins.Contains(PinName))
+	if (OutputPinIndex != INDEX_NONE)
 	{
 		// record for debugging, even if nothing is connected to this pin
 		TArray<FPinRecord>& Records = OutputRecords.FindOrAdd(PinName);
+		if (Records.Num() >= FPinRecord::MaxRecordsPerPin)
+		{
+			Records.RemoveAt(0, 1, EAllowShrinking::No);
+		}
 		Records.Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
 
 		if (const UFlowAsset* FlowAssetTemplate = GetFlowAsset()->GetTemplateAsset())
@@ -1458,10 +1655,9 @@ void UFlowNode::TriggerOutput(const FName PinName, const bool bFinish /*= false*
 #endif
 
 	// call the next node
-	if (OutputPins.Contains(PinName) && Connections.Contains(PinName))
+	if (OutputPinIndex != INDEX_NONE)
 	{
-		const FConnectedPin FlowPin = GetConnection(PinName);
-		GetFlowAsset()->TriggerInput(FlowPin.NodeGuid, FlowPin.PinName, FConnectedPin(GetGuid(), PinName));
+		GetFlowAsset()->TriggerConnectedInputs(*this, OutputPinIndex, PinName);
 	}
 }
 
@@ -1488,12 +1684,15 @@ void UFlowNode::Deactivate()
 		ActivationState = EFlowNodeState::Completed;
 	}
 
+	MarkSaveDirty();
 	Cleanup();
 }
 
 void UFlowNode::ResetRecords()
 {
 	ActivationState = EFlowNodeState::NeverActivated;
+	bRecordedByAsset = false;
+	MarkSaveDirty();
 
 #if !UE_BUILD_SHIPPING
 	InputRecords.Empty();
@@ -1504,18 +1703,38 @@ void UFlowNode::ResetRecords()
 void UFlowNode::SaveInstance(FFlowNodeSaveData& NodeRecord)
 {
 	NodeRecord.NodeGuid = NodeGuid;
+
+	const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	FFlowSaveNameTable* NameTable = FlowSubsystem ? FlowSubsystem->GetActiveSaveNameTable() : nullptr;
+
+	if (CanReuseSaveData(NameTable))
+	{
+		NodeRecord.NodeData = CachedSaveData;
+		return;
+	}
+
 	OnSave();
 
-	FMemoryWriter MemoryWriter(NodeRecord.NodeData, true);
-	FFlowArchive Ar(MemoryWriter);
-	Serialize(Ar);
+	FlowSave::WriteObject(*this, NodeRecord.NodeData, NameTable);
+
+	if (IsSaveDataCacheEnabled())
+	{
+		CachedSaveData = NodeRecord.NodeData;
+		CachedSaveFormatId = FlowSave::GetFormatId(NameTable);
+		bSaveDirty = false;
+	}
 }
 
 void UFlowNode::LoadInstance(const FFlowNodeSaveData& NodeRecord)
 {
-	FMemoryReader MemoryReader(NodeRecord.NodeData, true);
-	FFlowArchive Ar(MemoryReader);
-	Serialize(Ar);
+	const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (!FlowSave::ReadObject(*this, NodeRecord.NodeData, FlowSubsystem ? FlowSubsystem->GetLoadedSaveNameTable() : nullptr))
+	{
+		LogError(TEXT("Failed to read node data from SaveGame"), EFlowOnScreenMessageType::Disabled);
+		return;
+	}
+
+	MarkSaveDirty();
 
 	if (UFlowAsset* FlowAsset = GetFlowAsset())
 	{
@@ -1526,6 +1745,9 @@ void UFlowNode::LoadInstance(const FFlowNodeSaveData& NodeRecord)
 	{
 		case EFlowSignalMode::Enabled:
 			OnLoad();
+
+			// game has been saved while data pin assets were streaming in
+			RestoreDeferredInputs();
 			break;
 		case EFlowSignalMode::Disabled:
 			// designer doesn't want to execute this node's logic at all, so we kill it
@@ -1540,6 +1762,21 @@ void UFlowNode::LoadInstance(const FFlowNodeSaveData& NodeRecord)
 	}
 }
 
+bool UFlowNode::CanReuseSaveData(const FFlowSaveNameTable* NameTable) const
+{
+	return IsSaveDataCacheEnabled() && !bSaveDirty && CachedSaveFormatId == FlowSave::GetFormatId(NameTable);
+}
+
+void UFlowNode::MarkSaveDirty()
+{
+	bSaveDirty = true;
+
+	if (UFlowAsset* FlowAsset = GetFlowAsset())
+	{
+		FlowAsset->MarkSaveDirty();
+	}
+}
+
 void UFlowNode::OnSave_Implementation()
 {
 }
@@ -1554,7 +1791,7 @@ void UFlowNode::OnPassThrough_Implementation()
 	// pin connections aren't serialized to the SaveGame, so users can safely change connections post game release
 	for (const FFlowPin& OutputPin : OutputPins)
 	{
-		if (Connections.Contains(OutputPin.PinName))
+		if (GetConnections().Contains(OutputPin.PinName))
 		{
 			TriggerOutput(OutputPin.PinName, false, EFlowPinActivationType::PassThrough);
 		}
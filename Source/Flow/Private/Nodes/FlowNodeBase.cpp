@@ -11,6 +11,7 @@
 #include "Interfaces/FlowNamedPropertiesSupplierInterface.h"
 #include "Nodes/FlowNode.h"
 #include "Types/FlowArray.h"
+#include "Types/FlowDataPinResolveCache.h"
 #include "Types/FlowDataPinResults.h"
 #include "Types/FlowPinTypesStandard.h"
 #include "Types/FlowNamedDataPinProperty.h"
@@ -77,9 +78,14 @@ void UFlowNodeBase::InitializeInstance()
 
 		for (UFlowNodeAddOn* SourceAddOn : SourceAddOns)
 		{
-			// Create a new instance of each AddOn
-			if (IsValid(SourceAddOn))
+			if (IsValid(SourceAddOn) && SourceAddOn->GetOuter() == this)
 			{
+				// AddOn instanced already, this node is reused by a recycled Flow Asset instance
+				AddOns.Add(SourceAddOn);
+			}
+			else if (IsValid(SourceAddOn))
+			{
+				// Create a new instance of each AddOn
 				UFlowNodeAddOn* NewAddOnInstance = NewObject<UFlowNodeAddOn>(this, SourceAddOn->GetClass(), NAME_None, RF_Transient, SourceAddOn, false, nullptr);
 				AddOns.Add(NewAddOnInstance);
 			}
@@ -1002,6 +1008,11 @@ bool UFlowNodeBase::TryAddValueToFormatNamedArguments(const FFlowNamedDataPinPro
 }
 
 FFlowDataPinResult UFlowNodeBase::TryResolveDataPin(FName PinName) const
+{
+	return TryResolveDataPinWithValueSink(PinName, nullptr);
+}
+
+FFlowDataPinResult UFlowNodeBase::TryResolveDataPinWithValueSink(const FName& PinName, FFlowDataPinValueSink* ValueSink) const
 {
 	FFlowDataPinResult DataPinResult(EFlowDataPinResolveResult::Success);
 
@@ -1022,8 +1033,39 @@ FFlowDataPinResult UFlowNodeBase::TryResolveDataPin(FName PinName) const
 	for (int32 Index = PinValueSupplierDatas.Num() - 1; Index >= 0; --Index)
 	{
 		const FFlowPinValueSupplierData& SupplierData = PinValueSupplierDatas[Index];
+		const UObject* SupplierObject = SupplierData.PinValueSupplier->_getUObject();
+
+		if (const FFlowDataPinResult* CachedResult = FFlowDataPinResolveCacheScope::FindResult(*SupplierObject, SupplierData.SupplierPinName))
+		{
+			DataPinResult = *CachedResult;
+		}
+		else if (FFlowDataPinResolveCacheScope::IsActive())
+		{
+			// Cached results have to carry the ResultValue, so they bypass the value sink
+			{
+				const FFlowDataPinValueSink::FScopedPending ScopedPendingSink(nullptr);
+				DataPinResult = SupplierData.PinValueSupplier->TrySupplyDataPin(SupplierData.SupplierPinName);
+			}
+
+			FFlowDataPinResolveCacheScope::AddResult(*SupplierObject, SupplierData.SupplierPinName, DataPinResult);
+		}
+		else
+		{
+			if (ValueSink)
+			{
+				ValueSink->Reset(SupplierObject, SupplierData.SupplierPinName);
+			}
+
+			// Also hides the sink of an outer resolution from the resolutions nested in this supplier
+			const FFlowDataPinValueSink::FScopedPending ScopedPendingSink(ValueSink);
+			DataPinResult = SupplierData.PinValueSupplier->TrySupplyDataPin(SupplierData.SupplierPinName);
+		}
 
-		DataPinResult = SupplierData.PinValueSupplier->TrySupplyDataPin(SupplierData.SupplierPinName);
+		if (ValueSink && ValueSink->WasSupplied() && (!FlowPinType::IsSuccess(DataPinResult.Result) || DataPinResult.ResultValue.IsValid()))
+		{
+			// Supplier override replaced the result it got from the sink path, so its own result wins
+			ValueSink->Reset(nullptr, NAME_None);
+		}
 
 		if (FlowPinType::IsSuccess(DataPinResult.Result))
 		{
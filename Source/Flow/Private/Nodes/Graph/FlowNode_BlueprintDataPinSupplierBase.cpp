@@ -16,6 +16,8 @@ UFlowNode_BlueprintDataPinSupplierBase::UFlowNode_BlueprintDataPinSupplierBase()
 
 FFlowDataPinResult UFlowNode_BlueprintDataPinSupplierBase::TrySupplyDataPin(FName PinName) const
 {
+	// Blueprint might inspect the result of the Super call, so it always needs the ResultValue
+	const FFlowDataPinValueSink::FScopedPending SuspendPendingSink(nullptr);
 	return BP_TrySupplyDataPin(PinName);
 }
 
@@ -10,6 +10,8 @@
 UFlowNode_CustomInput::UFlowNode_CustomInput()
 {
 	InputPins.Empty();
+
+	InstancePoolingClass = StaticClass();
 }
 
 void UFlowNode_CustomInput::ExecuteInput(const FName& PinName)
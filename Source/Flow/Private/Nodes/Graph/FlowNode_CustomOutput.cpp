@@ -11,6 +11,8 @@
 UFlowNode_CustomOutput::UFlowNode_CustomOutput()
 {
 	OutputPins.Empty();
+
+	InstancePoolingClass = StaticClass();
 }
 
 void UFlowNode_CustomOutput::ExecuteInput(const FName& PinName)
@@ -17,6 +17,8 @@ UFlowNode_DefineProperties::UFlowNode_DefineProperties()
 	OutputPins.Empty();
 
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
+
+	ValueSinkNativeClass = StaticClass();
 }
 
 void UFlowNode_DefineProperties::PostLoad()
@@ -34,6 +36,39 @@ void UFlowNode_DefineProperties::PostLoad()
 	}
 }
 
+void UFlowNode_DefineProperties::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	NamedPropertyIndices.Reset();
+	for (int32 Index = 0; Index < NamedProperties.Num(); Index++)
+	{
+		if (NamedProperties[Index].IsValid() && !NamedPropertyIndices.Contains(NamedProperties[Index].Name))
+		{
+			NamedPropertyIndices.Add(NamedProperties[Index].Name, Index);
+		}
+	}
+}
+
+void UFlowNode_DefineProperties::DeinitializeInstance()
+{
+	NamedPropertyIndices.Empty();
+
+	Super::DeinitializeInstance();
+}
+
+const FFlowNamedDataPinProperty* UFlowNode_DefineProperties::FindNamedProperty(const FName& PropertyName) const
+{
+	// template nodes aren't indexed
+	if (NamedPropertyIndices.IsEmpty())
+	{
+		return IFlowNamedPropertiesSupplierInterface::FindNamedProperty(PropertyName);
+	}
+
+	const int32* Index = NamedPropertyIndices.Find(PropertyName);
+	return Index ? &NamedProperties[*Index] : nullptr;
+}
+
 #if WITH_EDITOR
 bool UFlowNode_DefineProperties::SupportsContextPins() const
 {
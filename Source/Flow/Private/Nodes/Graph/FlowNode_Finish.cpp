@@ -13,6 +13,8 @@ UFlowNode_Finish::UFlowNode_Finish()
 
 	OutputPins = {};
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
+
+	InstancePoolingClass = StaticClass();
 }
 
 void UFlowNode_Finish::ExecuteInput(const FName& PinName)
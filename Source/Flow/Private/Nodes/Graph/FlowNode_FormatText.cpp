@@ -17,6 +17,9 @@ UFlowNode_FormatText::UFlowNode_FormatText()
 #endif
 
 	OutputPins.Add(FFlowPin(OUTPIN_TextOutput, FFlowPinType_Text::GetPinTypeNameStatic()));
+
+	// TrySupplyDataPin() returns the Super result untouched
+	ValueSinkNativeClass = StaticClass();
 }
 
 FFlowDataPinResult UFlowNode_FormatText::TrySupplyDataPin(FName PinName) const
@@ -13,6 +13,9 @@ UFlowNode_Start::UFlowNode_Start()
 #endif
 
 	OutputPins = { UFlowNode::DefaultOutputPin };
+
+	// TrySupplyDataPin() returns the Super result untouched
+	ValueSinkNativeClass = StaticClass();
 }
 
 void UFlowNode_Start::ExecuteInput(const FName& PinName)
@@ -2,12 +2,16 @@
 
 #include "Nodes/Graph/FlowNode_SubGraph.h"
 
+#include "Asset/FlowAssetParams.h"
 #include "FlowAsset.h"
 #include "FlowSettings.h"
 #include "FlowSubsystem.h"
 #include "Interfaces/FlowNodeWithExternalDataPinSupplierInterface.h"
 #include "Types/FlowAutoDataPinsWorkingData.h"
 
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_SubGraph)
 
 #define LOCTEXT_NAMESPACE "FlowNode_SubGraph"
@@ -18,6 +22,7 @@ const FName UFlowNode_SubGraph::AssetParams_MemberName = GET_MEMBER_NAME_CHECKED
 
 UFlowNode_SubGraph::UFlowNode_SubGraph()
 	: bCanInstanceIdenticalAsset(false)
+	, bLoadAssetAsynchronously(false)
 {
 #if WITH_EDITOR
 	Category = TEXT("Graph");
@@ -26,6 +31,11 @@ UFlowNode_SubGraph::UFlowNode_SubGraph()
 	AllowedAssignedAssetClasses = {UFlowAsset::StaticClass()};
 #endif
 
+	SaveDataCacheClass = StaticClass();
+
+	// TrySupplyDataPin() returns the Super result untouched
+	ValueSinkNativeClass = StaticClass();
+
 	InputPins = {StartPin};
 	OutputPins = {FinishPin};
 }
@@ -37,27 +47,154 @@ bool UFlowNode_SubGraph::CanBeAssetInstanced() const
 
 EFlowPreloadResult UFlowNode_SubGraph::PreloadContent()
 {
+	FLOW_ASSERT_ENUM_MAX(EFlowPreloadResult, 2);
+
 	if (CanBeAssetInstanced() && GetFlowSubsystem())
 	{
+		if (TryLoadAssetAsync())
+		{
+			// CreateSubFlow is called once the asset is loaded, see OnAssetLoaded()
+			bPreloadingAsset = true;
+			return EFlowPreloadResult::PreloadInProgress;
+		}
+
 		GetFlowSubsystem()->CreateSubFlow(this, FString(), true);
 	}
 
-	FLOW_ASSERT_ENUM_MAX(EFlowPreloadResult, 2);
-
-	// TODO (gtaylor) CreateSubFlow is currently synchronous-only, 
-	// we could conceivably ADD ASYNC UFlowAsset load 
-	// (which could do the call CreateSubFlow after the asset was loaded).
 	return EFlowPreloadResult::Completed;
 }
 
 void UFlowNode_SubGraph::FlushContent()
 {
+	if (bPreloadingAsset)
+	{
+		bPreloadingAsset = false;
+
+		// inputs might be still waiting for the asset
+		if (BufferedInputNames.IsEmpty())
+		{
+			CancelAssetLoad();
+		}
+	}
+
 	if (CanBeAssetInstanced() && GetFlowSubsystem())
 	{
 		GetFlowSubsystem()->RemoveSubFlow(this, EFlowFinishPolicy::Abort);
 	}
 }
 
+bool UFlowNode_SubGraph::TryLoadAssetAsync()
+{
+	if (IsLoadingAsset())
+	{
+		return true;
+	}
+
+	// after a failed load, fall back to loading synchronously instead of requesting the same paths again
+	if (!bLoadAssetAsynchronously || bAsyncLoadCompleted)
+	{
+		return false;
+	}
+
+	TArray<FSoftObjectPath> PathsToLoad;
+	if (!Asset.IsNull() && Asset.Get() == nullptr)
+	{
+		PathsToLoad.Add(Asset.ToSoftObjectPath());
+	}
+
+	// params are streamed together with the asset, so supplying the subgraph's data pins won't load them
+	if (!AssetParams.IsNull() && AssetParams.Get() == nullptr && !IsInputConnected(AssetParams_MemberName, false))
+	{
+		PathsToLoad.Add(AssetParams.ToSoftObjectPath());
+	}
+
+	if (PathsToLoad.IsEmpty())
+	{
+		return false;
+	}
+
+	TSharedPtr<FStreamableHandle> LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(PathsToLoad,
+		FStreamableDelegate::CreateWeakLambda(this, [this]()
+		{
+			OnAssetLoaded();
+		}));
+
+	// streamable manager might complete the request immediately, if assets got loaded in the meantime or can't be loaded at all
+	if (LoadHandle.IsValid() && !LoadHandle->HasLoadCompleted())
+	{
+		AssetLoadHandle = LoadHandle;
+	}
+
+	return IsLoadingAsset();
+}
+
+void UFlowNode_SubGraph::OnAssetLoaded()
+{
+	// request completed immediately, TryLoadAssetAsync() reports it's not loading and the caller continues synchronously
+	if (!IsLoadingAsset())
+	{
+		return;
+	}
+
+	AssetLoadHandle.Reset();
+	bAsyncLoadCompleted = true;
+
+	const bool bAssetLoaded = Asset.Get() != nullptr;
+	if (!bAssetLoaded)
+	{
+		LogError(FString::Printf(TEXT("Failed to load Flow Asset %s"), *Asset.ToString()));
+	}
+
+	if (bPreloadingAsset)
+	{
+		bPreloadingAsset = false;
+
+		if (bAssetLoaded && GetFlowSubsystem())
+		{
+			GetFlowSubsystem()->CreateSubFlow(this, FString(), true);
+		}
+		NotifyPreloadComplete();
+	}
+
+	const TArray<FName> PinNames = MoveTemp(BufferedInputNames);
+	BufferedInputNames.Reset();
+	MarkSaveDirty();
+
+	if (!bAssetLoaded)
+	{
+		// there's no subgraph to execute, same as activating the node without an asset
+		if (!PinNames.IsEmpty())
+		{
+			Finish();
+		}
+		return;
+	}
+
+	for (const FName& PinName : PinNames)
+	{
+		// executed input might finish this node, which drops remaining inputs
+		if (HasFinished())
+		{
+			break;
+		}
+
+		ExecuteInput(PinName);
+	}
+}
+
+void UFlowNode_SubGraph::CancelAssetLoad()
+{
+	if (AssetLoadHandle.IsValid())
+	{
+		AssetLoadHandle->CancelHandle();
+		AssetLoadHandle.Reset();
+	}
+
+	bPreloadingAsset = false;
+	bAsyncLoadCompleted = false;
+	BufferedInputNames.Empty();
+}
+
 void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
 {
 	// Since this node implements IFlowPreloadableInterface,
@@ -82,6 +219,13 @@ void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
 		return;
 	}
 
+	// subgraph instance is created once the asset is loaded, keep the order of inputs until then
+	if ((IsLoadingAsset() || !BufferedInputNames.IsEmpty()) || (PinName == TEXT("Start") && TryLoadAssetAsync()))
+	{
+		BufferedInputNames.Add(PinName);
+		return;
+	}
+
 	if (PinName == TEXT("Start"))
 	{
 		if (GetFlowSubsystem())
@@ -97,6 +241,8 @@ void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
 
 void UFlowNode_SubGraph::Cleanup()
 {
+	CancelAssetLoad();
+
 	if (CanBeAssetInstanced() && GetFlowSubsystem())
 	{
 		GetFlowSubsystem()->RemoveSubFlow(this, EFlowFinishPolicy::Keep);
@@ -117,6 +263,17 @@ void UFlowNode_SubGraph::OnLoad_Implementation()
 		GetFlowSubsystem()->LoadSubFlow(this, SavedAssetInstanceName);
 		SavedAssetInstanceName = FString();
 	}
+	else if (!BufferedInputNames.IsEmpty())
+	{
+		// game has been saved while the asset was streaming in, execute inputs again
+		TArray<FName> SavedInputNames = MoveTemp(BufferedInputNames);
+		BufferedInputNames.Reset();
+
+		for (const FName& PinName : SavedInputNames)
+		{
+			ExecuteInput(PinName);
+		}
+	}
 }
 
 #if WITH_EDITOR
@@ -250,6 +407,15 @@ FFlowDataPinResult UFlowNode_SubGraph::TrySupplyDataPin(FName PinName) const
 
 	if (!IsInputConnected(PinName))
 	{
+		// unconnected AssetParams pin is read straight from the property, instead of resolving it for every supplied pin
+		if (!IsInputConnected(AssetParams_MemberName, false))
+		{
+			if (const UFlowAssetParams* LoadedAssetParams = AssetParams.Get())
+			{
+				return LoadedAssetParams->TrySupplyDataPin(PinName);
+			}
+		}
+
 		const bool bHasAssetParams = IsInputConnected(AssetParams_MemberName) || !AssetParams.IsNull();
 		if (bHasAssetParams)
 		{
@@ -27,6 +27,8 @@ UFlowNode_Branch::UFlowNode_Branch()
 	OutputPins.Add(FFlowPin(OUTPIN_False));
 
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
+
+	InstancePoolingClass = StaticClass();
 }
 
 EFlowAddOnAcceptResult UFlowNode_Branch::AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const
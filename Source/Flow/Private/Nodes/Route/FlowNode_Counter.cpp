@@ -13,6 +13,9 @@ UFlowNode_Counter::UFlowNode_Counter()
 	NodeDisplayStyle = FlowNodeStyle::Condition;
 #endif
 
+	SaveDataCacheClass = StaticClass();
+	InstancePoolingClass = StaticClass();
+
 	InputPins.Empty();
 	InputPins.Add(FFlowPin(TEXT("Increment")));
 	InputPins.Add(FFlowPin(TEXT("Decrement")));
@@ -12,6 +12,9 @@ UFlowNode_ExecutionMultiGate::UFlowNode_ExecutionMultiGate()
 	NodeDisplayStyle = FlowNodeStyle::Logic;
 #endif
 
+	SaveDataCacheClass = StaticClass();
+	InstancePoolingClass = StaticClass();
+
 	FString ResetPinTooltip = TEXT("Finish work of this node.");
 	ResetPinTooltip += LINE_TERMINATOR;
 	ResetPinTooltip += TEXT("Calling In input will start triggering output pins once again.");
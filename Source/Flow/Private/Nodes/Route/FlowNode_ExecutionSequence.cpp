@@ -12,6 +12,9 @@ UFlowNode_ExecutionSequence::UFlowNode_ExecutionSequence()
 	NodeDisplayStyle = FlowNodeStyle::Logic;
 #endif
 
+	SaveDataCacheClass = StaticClass();
+	InstancePoolingClass = StaticClass();
+
 	SetNumberedOutputPins(0, 1);
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
 }
@@ -11,6 +11,9 @@ UFlowNode_LogicalAND::UFlowNode_LogicalAND()
 	NodeDisplayStyle = FlowNodeStyle::Logic;
 #endif
 
+	SaveDataCacheClass = StaticClass();
+	InstancePoolingClass = StaticClass();
+
 	SetNumberedInputPins(0, 1);
 }
 
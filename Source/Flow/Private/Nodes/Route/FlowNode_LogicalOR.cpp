@@ -14,6 +14,8 @@ UFlowNode_LogicalOR::UFlowNode_LogicalOR()
 	NodeDisplayStyle = FlowNodeStyle::Logic;
 #endif
 
+	SaveDataCacheClass = StaticClass();
+
 	SetNumberedInputPins(0, 1);
 	InputPins.Add(FFlowPin(TEXT("Enable"), TEXT("Enabling resets Execution Count")));
 	InputPins.Add(FFlowPin(TEXT("Disable"), TEXT("Disabling resets Execution Count")));
@@ -12,6 +12,8 @@ UFlowNode_Reroute::UFlowNode_Reroute()
 #endif
 
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
+
+	InstancePoolingClass = StaticClass();
 }
 
 void UFlowNode_Reroute::ExecuteInput(const FName& PinName)
@@ -4,6 +4,7 @@
 #include "AddOns/FlowNodeAddOn.h"
 #include "FlowSettings.h"
 #include "Interfaces/FlowSwitchCaseInterface.h"
+#include "Types/FlowDataPinResolveCache.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_Switch)
 
@@ -26,6 +27,8 @@ UFlowNode_Switch::UFlowNode_Switch()
 	OutputPins.Add(FFlowPin(OUTPIN_DefaultCase.ToString(), FString(TEXT("Triggered when no cases pass (during a Switch Evaluate)"))));
 
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
+
+	InstancePoolingClass = StaticClass();
 }
 
 EFlowAddOnAcceptResult UFlowNode_Switch::AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const
@@ -40,6 +43,9 @@ EFlowAddOnAcceptResult UFlowNode_Switch::AcceptFlowNodeAddOnChild_Implementation
 
 void UFlowNode_Switch::ExecuteInput(const FName& PinName)
 {
+	// cases often read the same upstream data pins, cache is suspended and flushed by every triggered case
+	const FFlowDataPinResolveCacheScope DataPinResolveCache(GetDefault<UFlowSettings>()->bCacheDataPinValuesWhileEvaluating);
+
 	int32 TriggeringCaseCount = 0;
 
 	// Trigger the IFlowSwitchCaseInterface addons that pass
@@ -2,9 +2,7 @@
 
 #include "Nodes/Route/FlowNode_Timer.h"
 #include "FlowSettings.h"
-
-#include "Engine/World.h"
-#include "TimerManager.h"
+#include "FlowSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_Timer)
 
@@ -69,22 +67,16 @@ void UFlowNode_Timer::ExecuteInput(const FName& PinName)
 
 void UFlowNode_Timer::SetTimer()
 {
-	if (GetWorld())
+	if (FFlowTimerWheel* TimerWheel = GetTimerWheel())
 	{
 		if (StepTime > 0.0f)
 		{
-			GetWorld()->GetTimerManager().SetTimer(StepTimerHandle, this, &UFlowNode_Timer::OnStep, StepTime, true);
+			TimerWheel->SetTimer(StepTimerHandle, FSimpleDelegate::CreateUObject(this, &UFlowNode_Timer::OnStep), StepTime, true);
 		}
 
+		// timer with zero time completes in the next tick
 		ResolvedCompletionTime = ResolveCompletionTime();
-		if (ResolvedCompletionTime > UE_KINDA_SMALL_NUMBER)
-		{
-			GetWorld()->GetTimerManager().SetTimer(CompletionTimerHandle, this, &UFlowNode_Timer::OnCompletion, ResolvedCompletionTime, false);
-		}
-		else
-		{
-			GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UFlowNode_Timer::OnCompletion);
-		}
+		TimerWheel->SetTimer(CompletionTimerHandle, FSimpleDelegate::CreateUObject(this, &UFlowNode_Timer::OnCompletion), FMath::Max(ResolvedCompletionTime, 0.0f), false);
 	}
 	else
 	{
@@ -112,6 +104,12 @@ float UFlowNode_Timer::ResolveCompletionTime() const
 	return ResolvedTime;
 }
 
+FFlowTimerWheel* UFlowNode_Timer::GetTimerWheel() const
+{
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	return FlowSubsystem ? FlowSubsystem->GetTimerWheel(GetWorld()) : nullptr;
+}
+
 void UFlowNode_Timer::OnStep()
 {
 	SumOfSteps += StepTime;
@@ -133,16 +131,15 @@ void UFlowNode_Timer::OnCompletion()
 
 void UFlowNode_Timer::Cleanup()
 {
-	if (GetWorld())
+	if (CompletionTimerHandle.IsValid() || StepTimerHandle.IsValid())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(CompletionTimerHandle);
+		if (FFlowTimerWheel* TimerWheel = GetTimerWheel())
+		{
+			TimerWheel->ClearTimer(CompletionTimerHandle);
+			TimerWheel->ClearTimer(StepTimerHandle);
+		}
 	}
 	CompletionTimerHandle.Invalidate();
-
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(StepTimerHandle);
-	}
 	StepTimerHandle.Invalidate();
 
 	SumOfSteps = 0.0f;
@@ -152,30 +149,31 @@ void UFlowNode_Timer::Cleanup()
 
 void UFlowNode_Timer::OnSave_Implementation()
 {
-	if (GetWorld())
+	if (const FFlowTimerWheel* TimerWheel = GetTimerWheel())
 	{
-		if (CompletionTimerHandle.IsValid())
+		if (TimerWheel->IsTimerActive(CompletionTimerHandle))
 		{
-			RemainingCompletionTime = GetWorld()->GetTimerManager().GetTimerRemaining(CompletionTimerHandle);
+			RemainingCompletionTime = TimerWheel->GetTimerRemaining(CompletionTimerHandle);
 		}
 
-		if (StepTimerHandle.IsValid())
+		if (TimerWheel->IsTimerActive(StepTimerHandle))
 		{
-			RemainingStepTime = GetWorld()->GetTimerManager().GetTimerRemaining(StepTimerHandle);
+			RemainingStepTime = TimerWheel->GetTimerRemaining(StepTimerHandle);
 		}
 	}
 }
 
 void UFlowNode_Timer::OnLoad_Implementation()
 {
-	if (RemainingStepTime > 0.0f || RemainingCompletionTime > 0.0f)
+	FFlowTimerWheel* TimerWheel = GetTimerWheel();
+	if (TimerWheel && (RemainingStepTime > 0.0f || RemainingCompletionTime > 0.0f))
 	{
 		if (RemainingStepTime > 0.0f)
 		{
-			GetWorld()->GetTimerManager().SetTimer(StepTimerHandle, this, &UFlowNode_Timer::OnStep, StepTime, true, RemainingStepTime);
+			TimerWheel->SetTimer(StepTimerHandle, FSimpleDelegate::CreateUObject(this, &UFlowNode_Timer::OnStep), StepTime, true, RemainingStepTime);
 		}
 
-		GetWorld()->GetTimerManager().SetTimer(CompletionTimerHandle, this, &UFlowNode_Timer::OnCompletion, RemainingCompletionTime, false);
+		TimerWheel->SetTimer(CompletionTimerHandle, FSimpleDelegate::CreateUObject(this, &UFlowNode_Timer::OnCompletion), RemainingCompletionTime, false);
 
 		RemainingStepTime = 0.0f;
 		RemainingCompletionTime = 0.0f;
@@ -237,7 +235,10 @@ FString UFlowNode_Timer::GetStatusString() const
 	}
 	else if (CompletionTimerHandle.IsValid() && GetWorld())
 	{
-		ProgressString = FString::Printf(TEXT("%.*f"), 2, GetWorld()->GetTimerManager().GetTimerElapsed(CompletionTimerHandle));
+		if (const FFlowTimerWheel* TimerWheel = GetTimerWheel())
+		{
+			ProgressString = FString::Printf(TEXT("%.*f"), 2, TimerWheel->GetTimerElapsed(CompletionTimerHandle));
+		}
 	}
 
 	if (!ProgressString.IsEmpty())
@@ -68,9 +68,11 @@ void FFlowPreloadHelper_Standard::TriggerFlush(UFlowNode& Node)
 {
 	// Reset pending count first. Any late-arriving PreloadInProgress NotifyPreloadComplete()
 	// will be rejected by the PendingPreloadCount <= 0 guard in OnPreloadComplete.
+	const bool bPreloadInProgress = PendingPreloadCount > 0;
 	PendingPreloadCount = 0;
 
-	if (bContentPreloaded)
+	// flushing while preload is in progress cancels it, otherwise participants would create content nobody releases
+	if (bContentPreloaded || bPreloadInProgress)
 	{
 		bContentPreloaded = false;
 
@@ -111,12 +113,14 @@ EFlowPreloadResult FFlowPreloadHelper_Standard::OnPreloadComplete(UFlowNode& /*N
 
 void FFlowPreloadHelper_Standard::OnNodeActivate(UFlowNode& Node)
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowPreloadTiming, 3);
+	FLOW_ASSERT_ENUM_MAX(EFlowPreloadTiming, 4);
 
 	if (const UFlowAsset* FlowAsset = Node.GetFlowAsset())
 	{
+		// lookahead nodes normally are preloaded already, unless activated from outside of the lookahead range
 		const FFlowPreloadPolicy& Policy = FlowAsset->GetPreloadPolicy();
-		if (Policy.GetPreloadTimingForNode(Node) == EFlowPreloadTiming::OnActivate)
+		const EFlowPreloadTiming PreloadTiming = Policy.GetPreloadTimingForNode(Node);
+		if (PreloadTiming == EFlowPreloadTiming::OnActivate || PreloadTiming == EFlowPreloadTiming::WithinLookahead)
 		{
 			TriggerPreload(Node);
 		}
@@ -125,7 +129,7 @@ void FFlowPreloadHelper_Standard::OnNodeActivate(UFlowNode& Node)
 
 void FFlowPreloadHelper_Standard::OnNodeInitializeInstance(UFlowNode& Node)
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowPreloadTiming, 3);
+	FLOW_ASSERT_ENUM_MAX(EFlowPreloadTiming, 4);
 
 	if (const UFlowAsset* FlowAsset = Node.GetFlowAsset())
 	{
@@ -139,7 +143,7 @@ void FFlowPreloadHelper_Standard::OnNodeInitializeInstance(UFlowNode& Node)
 
 void FFlowPreloadHelper_Standard::OnNodeCleanup(UFlowNode& Node)
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowFlushTiming, 3);
+	FLOW_ASSERT_ENUM_MAX(EFlowFlushTiming, 4);
 
 	if (const UFlowAsset* FlowAsset = Node.GetFlowAsset())
 	{
@@ -153,7 +157,7 @@ void FFlowPreloadHelper_Standard::OnNodeCleanup(UFlowNode& Node)
 
 void FFlowPreloadHelper_Standard::OnNodeDeinitializeInstance(UFlowNode& Node)
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowFlushTiming, 3);
+	FLOW_ASSERT_ENUM_MAX(EFlowFlushTiming, 4);
 
 	if (const UFlowAsset* FlowAsset = Node.GetFlowAsset())
 	{
@@ -0,0 +1,151 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Policies/FlowPreloadLookahead.h"
+
+#include "Asset/FlowExecutionPlan.h"
+#include "FlowAsset.h"
+#include "Nodes/FlowNode.h"
+#include "Policies/FlowPreloadPolicy.h"
+
+void FFlowPreloadLookahead::Initialize(const UFlowAsset& FlowAsset, const FFlowPreloadPolicy& Policy)
+{
+	Reset();
+
+	const TSharedRef<const FFlowExecutionPlan> Plan = FlowAsset.GetOrBuildExecutionPlan();
+	for (int32 NodeIndex = 0; NodeIndex < Plan->GetNumNodes(); NodeIndex++)
+	{
+		UFlowNode* Node = FlowAsset.GetNode(Plan->GetNodeGuid(NodeIndex));
+		if (Node == nullptr || !Node->PreloadHelper.IsValid())
+		{
+			continue;
+		}
+
+		const bool bPreloadWhenEntering = Policy.GetPreloadTimingForNode(*Node) == EFlowPreloadTiming::WithinLookahead;
+		const bool bFlushWhenLeaving = Policy.GetFlushTimingForNode(*Node) == EFlowFlushTiming::OnLeavingLookahead;
+		if (bPreloadWhenEntering || bFlushWhenLeaving)
+		{
+			FTrackedNode& TrackedNode = TrackedNodes.AddDefaulted_GetRef();
+			TrackedNode.Node = Node;
+			TrackedNode.NodeIndex = NodeIndex;
+			TrackedNode.LookaheadDistance = FMath::Max(Policy.GetLookaheadDistanceForNode(*Node), 0);
+			TrackedNode.bPreloadWhenEntering = bPreloadWhenEntering;
+			TrackedNode.bFlushWhenLeaving = bFlushWhenLeaving;
+
+			MaxLookaheadDistance = FMath::Max(MaxLookaheadDistance, TrackedNode.LookaheadDistance);
+		}
+	}
+
+	if (IsEnabled())
+	{
+		Distances.Init(INDEX_NONE, Plan->GetNumNodes());
+	}
+}
+
+void FFlowPreloadLookahead::Reset()
+{
+	TrackedNodes.Empty();
+	MaxLookaheadDistance = 0;
+	Distances.Empty();
+	SearchQueue.Empty();
+	bUpdateRequested = false;
+}
+
+void FFlowPreloadLookahead::Update(const UFlowAsset& FlowAsset)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	if (bIsUpdating)
+	{
+		bUpdateRequested = true;
+		return;
+	}
+
+	const TSharedRef<const FFlowExecutionPlan> Plan = FlowAsset.GetOrBuildExecutionPlan();
+	if (Plan->GetNumNodes() != Distances.Num())
+	{
+		return;
+	}
+
+	TGuardValue<bool> UpdateGuard(bIsUpdating, true);
+	do
+	{
+		bUpdateRequested = false;
+
+		FindDistances(*Plan, FlowAsset);
+		ApplyRanges();
+
+		for (const int32 NodeIndex : SearchQueue)
+		{
+			Distances[NodeIndex] = INDEX_NONE;
+		}
+		SearchQueue.Reset();
+	}
+	while (bUpdateRequested && IsEnabled());
+}
+
+void FFlowPreloadLookahead::FindDistances(const FFlowExecutionPlan& Plan, const UFlowAsset& FlowAsset)
+{
+	for (const UFlowNode* ActiveNode : FlowAsset.GetActiveNodes())
+	{
+		if (Distances.IsValidIndex(ActiveNode->PlanNodeIndex) && Distances[ActiveNode->PlanNodeIndex] == INDEX_NONE)
+		{
+			Distances[ActiveNode->PlanNodeIndex] = 0;
+			SearchQueue.Add(ActiveNode->PlanNodeIndex);
+		}
+	}
+
+	for (int32 QueueIndex = 0; QueueIndex < SearchQueue.Num(); QueueIndex++)
+	{
+		const int32 NodeIndex = SearchQueue[QueueIndex];
+		const int32 NextDistance = Distances[NodeIndex] + 1;
+		if (NextDistance > MaxLookaheadDistance)
+		{
+			continue;
+		}
+
+		for (const FFlowExecutionPlanOutput& Output : Plan.GetOutputs(NodeIndex))
+		{
+			for (const FFlowExecutionPlanTarget& Target : Plan.GetTargets(Output))
+			{
+				if (Distances[Target.NodeIndex] == INDEX_NONE)
+				{
+					Distances[Target.NodeIndex] = NextDistance;
+					SearchQueue.Add(Target.NodeIndex);
+				}
+			}
+		}
+	}
+}
+
+void FFlowPreloadLookahead::ApplyRanges()
+{
+	for (FTrackedNode& TrackedNode : TrackedNodes)
+	{
+		const int32 Distance = Distances[TrackedNode.NodeIndex];
+		const bool bInRange = Distance != INDEX_NONE && Distance <= TrackedNode.LookaheadDistance;
+		if (bInRange == TrackedNode.bInRange)
+		{
+			continue;
+		}
+
+		TrackedNode.bInRange = bInRange;
+
+		UFlowNode* Node = TrackedNode.Node.Get();
+		if (Node == nullptr)
+		{
+			continue;
+		}
+
+		if (bInRange && TrackedNode.bPreloadWhenEntering)
+		{
+			Node->TriggerPreload();
+		}
+		else if (!bInRange && TrackedNode.bFlushWhenLeaving)
+		{
+			Node->TriggerFlush();
+		}
+	}
+}
@@ -26,6 +26,16 @@ EFlowFlushTiming FFlowPreloadPolicy_Standard::GetFlushTimingForNode(const UFlowN
 	return DefaultFlushTiming;
 }
 
+int32 FFlowPreloadPolicy_Standard::GetLookaheadDistanceForNode(const UFlowNode& Node) const
+{
+	if (const int32* OverrideDistance = NodeLookaheadDistanceOverrides.Find(Node.GetClass()->GetFName()))
+	{
+		return FMath::Max(*OverrideDistance, 0);
+	}
+
+	return FMath::Max(DefaultLookaheadDistance, 0);
+}
+
 UScriptStruct* FFlowPreloadPolicy_Standard::GetPreloadHelperStructType(const UFlowNode& Node) const
 {
 	return FFlowPreloadHelper_Standard::StaticStruct();
@@ -0,0 +1,77 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowDataPinResolveCache.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowDataPinResolveCache)
+
+FFlowDataPinResolveCacheScope* FFlowDataPinResolveCacheScope::Active = nullptr;
+FFlowDataPinResolveCacheStats FFlowDataPinResolveCacheScope::Stats;
+
+FFlowDataPinResolveCacheScope::FFlowDataPinResolveCacheScope(const bool bEnabled)
+{
+	if (bEnabled && Active == nullptr && IsInGameThread())
+	{
+		Active = this;
+		bOwnsCache = true;
+	}
+}
+
+FFlowDataPinResolveCacheScope::~FFlowDataPinResolveCacheScope()
+{
+	if (bOwnsCache)
+	{
+		Active = nullptr;
+	}
+}
+
+const FFlowDataPinResult* FFlowDataPinResolveCacheScope::FindResult(const UObject& Supplier, const FName& SupplierPinName)
+{
+	if (Active == nullptr || !IsInGameThread())
+	{
+		return nullptr;
+	}
+
+	const FFlowDataPinResult* CachedResult = Active->CachedResults.Find(TPair<FObjectKey, FName>(&Supplier, SupplierPinName));
+	if (CachedResult)
+	{
+		Stats.NumHits++;
+	}
+
+	return CachedResult;
+}
+
+void FFlowDataPinResolveCacheScope::AddResult(const UObject& Supplier, const FName& SupplierPinName, const FFlowDataPinResult& Result)
+{
+	if (Active && IsInGameThread())
+	{
+		Active->CachedResults.Add(TPair<FObjectKey, FName>(&Supplier, SupplierPinName), Result);
+		Stats.NumMisses++;
+	}
+}
+
+void FFlowDataPinResolveCacheScope::Invalidate()
+{
+	if (Active && IsInGameThread() && Active->CachedResults.Num() > 0)
+	{
+		Active->CachedResults.Reset();
+		Stats.NumInvalidations++;
+	}
+}
+
+FFlowDataPinResolveCacheSuspendScope::FFlowDataPinResolveCacheSuspendScope()
+{
+	if (IsInGameThread())
+	{
+		SuspendedScope = FFlowDataPinResolveCacheScope::Active;
+		FFlowDataPinResolveCacheScope::Active = nullptr;
+	}
+}
+
+FFlowDataPinResolveCacheSuspendScope::~FFlowDataPinResolveCacheSuspendScope()
+{
+	if (SuspendedScope)
+	{
+		FFlowDataPinResolveCacheScope::Active = SuspendedScope;
+		FFlowDataPinResolveCacheScope::Invalidate();
+	}
+}
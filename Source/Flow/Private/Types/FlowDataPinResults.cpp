@@ -1,10 +1,83 @@
 // Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
 
 #include "Types/FlowDataPinResults.h"
+#include "Interfaces/FlowDataPinValueOwnerInterface.h"
 #include "Types/FlowDataPinValuesStandard.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowDataPinResults)
 
+// FFlowDataPinValueSink
+
+FFlowDataPinValueSink* FFlowDataPinValueSink::Pending = nullptr;
+
+FFlowDataPinValueSink* FFlowDataPinValueSink::FindPending(const UObject& InSupplier, const FName& PinName, const FName& InPinTypeName)
+{
+	if (Pending && IsInGameThread() && !Pending->bSupplied && Pending->Supplier == &InSupplier && Pending->SupplierPinName == PinName && Pending->PinTypeName == InPinTypeName)
+	{
+		return Pending;
+	}
+
+	return nullptr;
+}
+
+FFlowDataPinValueSink::FScopedPending::FScopedPending(FFlowDataPinValueSink* InSink)
+	: bIsActive(IsInGameThread())
+{
+	if (bIsActive)
+	{
+		PreviousSink = Pending;
+		Pending = InSink;
+	}
+}
+
+FFlowDataPinValueSink::FScopedPending::~FScopedPending()
+{
+	if (bIsActive)
+	{
+		Pending = PreviousSink;
+	}
+}
+
+void FFlowDataPinValueSink::Reset(const UObject* InSupplier, const FName& InSupplierPinName)
+{
+	Supplier = InSupplier;
+	SupplierPinName = InSupplierPinName;
+	Result = EFlowDataPinResolveResult::FailedUnimplemented;
+	bSupplied = false;
+}
+
+bool FFlowDataPinValueSink::TrySupplyFromOwner(const UObject& PropertyOwnerObject, const FName& PropertyName)
+{
+	const IFlowDataPinValueOwnerInterface* PropertyOwnerInterface = Cast<IFlowDataPinValueOwnerInterface>(&PropertyOwnerObject);
+	if (!PropertyOwnerInterface)
+	{
+		return false;
+	}
+
+	const FProperty* FoundProperty = nullptr;
+	const FFlowDataPinValue* FoundValue = nullptr;
+	if (!PropertyOwnerInterface->TryFindPropertyViewByPinName(PropertyName, FoundProperty, FoundValue))
+	{
+		return false;
+	}
+
+	return FoundValue ? TrySupplyFromValue(*FoundValue) : TrySupplyFromProperty(FoundProperty, &PropertyOwnerObject);
+}
+
+bool FFlowDataPinValueSink::TrySupplyFromProperty(const FProperty* Property, const void* Container)
+{
+	Result = ExtractFromPropertyFunc(Property, Container, SingleFromArray, OutValue);
+	bSupplied = Result != EFlowDataPinResolveResult::FailedMismatchedType;
+	return bSupplied;
+}
+
+bool FFlowDataPinValueSink::TrySupplyFromValue(const FFlowDataPinValue& Value)
+{
+	Result = ExtractFromValueFunc(Value, SingleFromArray, OutValue);
+	bSupplied = Result != EFlowDataPinResolveResult::FailedMismatchedType;
+	return bSupplied;
+}
+
 FFlowDataPinResult_Object::FFlowDataPinResult_Object(UObject* InValue)
 	: Super(EFlowDataPinResolveResult::Success)
 {
@@ -300,7 +300,7 @@ void FFlowDataPinValue_Enum::OnEnumNameChanged()
 
 UField* FFlowDataPinValue_Enum::GetFieldType() const
 {
-	return EnumClass.LoadSynchronous();
+	return Cast<UEnum>(FlowSoftReference::LoadOrDefer(EnumClass.ToSoftObjectPath()));
 }
 
 bool FFlowDataPinValue_Enum::TryConvertValuesToString(FString& OutString) const
@@ -198,7 +198,7 @@ UObject* FFlowPinType_Enum::GetPinSubCategoryObjectFromProperty(const FProperty*
 	{
 		const FFlowDataPinValue_Enum* EnumWrapper = static_cast<const FFlowDataPinValue_Enum*>(Wrapper);
 		TSoftObjectPtr<UEnum> EnumClassPtr = EnumWrapper->EnumClass;
-		EnumClass = EnumClassPtr.LoadSynchronous();
+		EnumClass = Cast<UEnum>(FlowSoftReference::LoadOrDefer(EnumClassPtr.ToSoftObjectPath()));
 	}
 	else if (Property)
 	{
@@ -209,7 +209,7 @@ UObject* FFlowPinType_Enum::GetPinSubCategoryObjectFromProperty(const FProperty*
 			{
 				FFlowDataPinValue_Enum ValueStruct;
 				StructProperty->GetValue_InContainer(InContainer, &ValueStruct);
-				EnumClass = ValueStruct.EnumClass.LoadSynchronous();
+				EnumClass = Cast<UEnum>(FlowSoftReference::LoadOrDefer(ValueStruct.EnumClass.ToSoftObjectPath()));
 			}
 		}
 		else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
@@ -0,0 +1,90 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowSoftReferenceLoading.h"
+
+DEFINE_STAT(STAT_FlowDataPinSyncLoads);
+
+namespace FlowSoftReference
+{
+	static int32 NumSyncLoads = 0;
+
+	UObject* LoadOrDefer(const FSoftObjectPath& Path)
+	{
+		if (Path.IsNull())
+		{
+			return nullptr;
+		}
+
+		if (UObject* LoadedObject = Path.ResolveObject())
+		{
+			return LoadedObject;
+		}
+
+		if (FFlowDeferredLoadScope::TryDefer(Path))
+		{
+			return nullptr;
+		}
+
+		INC_DWORD_STAT(STAT_FlowDataPinSyncLoads);
+		NumSyncLoads++;
+
+		return Path.TryLoad();
+	}
+
+	UObject* ResolveOrDefer(const FSoftObjectPath& Path)
+	{
+		if (Path.IsNull())
+		{
+			return nullptr;
+		}
+
+		UObject* LoadedObject = Path.ResolveObject();
+		if (LoadedObject == nullptr)
+		{
+			FFlowDeferredLoadScope::TryDefer(Path);
+		}
+
+		return LoadedObject;
+	}
+
+	int32 GetNumSyncLoads()
+	{
+		return NumSyncLoads;
+	}
+
+	void ResetNumSyncLoads()
+	{
+		NumSyncLoads = 0;
+	}
+}
+
+FFlowDeferredLoadScope* FFlowDeferredLoadScope::Active = nullptr;
+
+FFlowDeferredLoadScope::FFlowDeferredLoadScope()
+{
+	if (IsInGameThread())
+	{
+		OuterScope = Active;
+		Active = this;
+		bRegistered = true;
+	}
+}
+
+FFlowDeferredLoadScope::~FFlowDeferredLoadScope()
+{
+	if (bRegistered)
+	{
+		Active = OuterScope;
+	}
+}
+
+bool FFlowDeferredLoadScope::TryDefer(const FSoftObjectPath& Path)
+{
+	if (Active == nullptr || !IsInGameThread())
+	{
+		return false;
+	}
+
+	Active->DeferredPaths.AddUnique(Path);
+	return true;
+}
@@ -0,0 +1,363 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowTimerWheel.h"
+
+#include "Engine/World.h"
+
+FFlowTimerWheel::FFlowTimerWheel(UWorld* InWorld)
+	: World(InWorld)
+{
+	BucketHeads.Init(INDEX_NONE, OverflowBucket + 1);
+	CurrentTick = TimeToTick(GetTime());
+}
+
+void FFlowTimerWheel::SetTimer(FFlowTimerHandle& InOutHandle, FSimpleDelegate&& Callback, const float Rate, const bool bLoop, const float FirstDelay /* = -1.0f */)
+{
+	ClearTimer(InOutHandle);
+
+	if (NumActiveTimers == 0 && !bIsAdvancing)
+	{
+		// wheel doesn't tick while empty, catch up with the world time
+		CurrentTick = FMath::Max(CurrentTick, TimeToTick(GetTime()));
+	}
+
+	const int32 TimerIndex = AllocateTimer();
+	FTimer& Timer = Timers[TimerIndex];
+	Timer.Callback = MoveTemp(Callback);
+	Timer.Rate = FMath::Max(Rate, 0.0f);
+	Timer.bLoop = bLoop && Timer.Rate > UE_KINDA_SMALL_NUMBER;
+	Timer.ExpireTime = GetTime() + (FirstDelay >= 0.0f ? FirstDelay : Timer.Rate);
+
+	// world time doesn't change within a frame, so the next wheel tick never expires before the next frame
+	// otherwise timer set before the wheel ticked in this frame would fire in the same frame, possibly re-entering the caller
+	const double NextTickTime = static_cast<double>(TimeToTick(GetTime()) + 1) / TicksPerSecond;
+	Timer.ExpireTime = FMath::Max(Timer.ExpireTime, NextTickTime);
+
+	InOutHandle.Index = TimerIndex;
+	InOutHandle.Serial = Timer.Serial;
+
+	if (bIsAdvancing)
+	{
+		Timer.State = ETimerState::Pending;
+		PendingTimers.Add(TimerIndex);
+	}
+	else
+	{
+		Timer.State = ETimerState::Scheduled;
+		Schedule(TimerIndex);
+	}
+}
+
+void FFlowTimerWheel::ClearTimer(FFlowTimerHandle& InOutHandle)
+{
+	if (FindTimer(InOutHandle))
+	{
+		const int32 TimerIndex = InOutHandle.Index;
+		switch (Timers[TimerIndex].State)
+		{
+			case ETimerState::Scheduled:
+				Unlink(TimerIndex);
+				FreeTimer(TimerIndex);
+				break;
+			case ETimerState::Pending:
+				PendingTimers.RemoveSingleSwap(TimerIndex, EAllowShrinking::No);
+				FreeTimer(TimerIndex);
+				break;
+			case ETimerState::Executing:
+				// timer is cleared while expiring in the current tick, it's released once the wheel gets back to it
+				Timers[TimerIndex].State = ETimerState::ExecutingCleared;
+				break;
+			default:
+				break;
+		}
+	}
+
+	InOutHandle.Invalidate();
+}
+
+bool FFlowTimerWheel::IsTimerActive(const FFlowTimerHandle& Handle) const
+{
+	return FindTimer(Handle) != nullptr;
+}
+
+float FFlowTimerWheel::GetTimerRemaining(const FFlowTimerHandle& Handle) const
+{
+	if (const FTimer* Timer = FindTimer(Handle))
+	{
+		return FMath::Max(0.0f, static_cast<float>(Timer->ExpireTime - GetTime()));
+	}
+
+	return -1.0f;
+}
+
+float FFlowTimerWheel::GetTimerElapsed(const FFlowTimerHandle& Handle) const
+{
+	if (const FTimer* Timer = FindTimer(Handle))
+	{
+		return FMath::Max(0.0f, Timer->Rate - static_cast<float>(Timer->ExpireTime - GetTime()));
+	}
+
+	return -1.0f;
+}
+
+void FFlowTimerWheel::Advance(const double Now)
+{
+	check(!bIsAdvancing);
+
+	const int64 TargetTick = TimeToTick(Now);
+	if (NumActiveTimers == 0)
+	{
+		CurrentTick = FMath::Max(CurrentTick, TargetTick);
+		return;
+	}
+
+	{
+		TGuardValue<bool> AdvancingGuard(bIsAdvancing, true);
+		TArray<int32, TInlineAllocator<32>> ExpiredTimers;
+
+		while (true)
+		{
+			// buckets of past ticks expire entirely, the current one might contain timers expiring later in this tick
+			const bool bPastTick = CurrentTick < TargetTick;
+			CollectExpired(static_cast<int32>(CurrentTick & (NumBuckets - 1)), Now, bPastTick, ExpiredTimers);
+
+			for (const int32 TimerIndex : ExpiredTimers)
+			{
+				Execute(TimerIndex, Now);
+			}
+			ExpiredTimers.Reset();
+
+			if (!bPastTick)
+			{
+				break;
+			}
+
+			CurrentTick++;
+			if ((CurrentTick & (NumBuckets - 1)) == 0)
+			{
+				// entering the next span of level 0, move timers down starting from the highest level
+				for (int32 Level = NumLevels; Level > 0; Level--)
+				{
+					const int32 LevelShift = Level * BucketBits;
+					if ((CurrentTick & ((int64(1) << LevelShift) - 1)) == 0)
+					{
+						CascadeBucket(Level == NumLevels ? OverflowBucket : Level * NumBuckets + static_cast<int32>((CurrentTick >> LevelShift) & (NumBuckets - 1)));
+					}
+				}
+			}
+		}
+	}
+
+	for (const int32 TimerIndex : PendingTimers)
+	{
+		Timers[TimerIndex].State = ETimerState::Scheduled;
+		Schedule(TimerIndex);
+	}
+	PendingTimers.Reset();
+}
+
+void FFlowTimerWheel::Tick(float DeltaTime)
+{
+	Advance(GetTime());
+}
+
+bool FFlowTimerWheel::IsTickable() const
+{
+	return NumActiveTimers > 0 && World.IsValid();
+}
+
+UWorld* FFlowTimerWheel::GetTickableGameObjectWorld() const
+{
+	return World.Get();
+}
+
+TStatId FFlowTimerWheel::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FFlowTimerWheel, STATGROUP_Tickables);
+}
+
+double FFlowTimerWheel::GetTime() const
+{
+	const UWorld* WorldPtr = World.Get();
+	return WorldPtr ? WorldPtr->GetTimeSeconds() : 0.0;
+}
+
+const FFlowTimerWheel::FTimer* FFlowTimerWheel::FindTimer(const FFlowTimerHandle& Handle) const
+{
+	if (Timers.IsValidIndex(Handle.Index))
+	{
+		const FTimer& Timer = Timers[Handle.Index];
+		if (Timer.Serial == Handle.Serial && Timer.State != ETimerState::Free && Timer.State != ETimerState::ExecutingCleared)
+		{
+			return &Timer;
+		}
+	}
+
+	return nullptr;
+}
+
+int32 FFlowTimerWheel::AllocateTimer()
+{
+	int32 TimerIndex = FirstFreeTimer;
+	if (TimerIndex != INDEX_NONE)
+	{
+		FirstFreeTimer = Timers[TimerIndex].Next;
+		Timers[TimerIndex].Next = INDEX_NONE;
+	}
+	else
+	{
+		TimerIndex = Timers.AddDefaulted();
+	}
+
+	// invalidates handles of the previous timer using this slot
+	Timers[TimerIndex].Serial++;
+	NumActiveTimers++;
+
+	return TimerIndex;
+}
+
+void FFlowTimerWheel::FreeTimer(const int32 TimerIndex)
+{
+	FTimer& Timer = Timers[TimerIndex];
+	Timer.Callback.Unbind();
+	Timer.State = ETimerState::Free;
+	Timer.Bucket = INDEX_NONE;
+	Timer.Prev = INDEX_NONE;
+	Timer.Next = FirstFreeTimer;
+
+	FirstFreeTimer = TimerIndex;
+	NumActiveTimers--;
+}
+
+void FFlowTimerWheel::Schedule(const int32 TimerIndex)
+{
+	const int64 ExpireTick = FMath::Max(TimeToTick(Timers[TimerIndex].ExpireTime), CurrentTick);
+
+	// the lowest level which span contains both current and expire ticks
+	int32 Bucket = OverflowBucket;
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		const int32 SpanShift = (Level + 1) * BucketBits;
+		if ((ExpireTick >> SpanShift) == (CurrentTick >> SpanShift))
+		{
+			Bucket = Level * NumBuckets + static_cast<int32>((ExpireTick >> (Level * BucketBits)) & (NumBuckets - 1));
+			break;
+		}
+	}
+
+	Link(TimerIndex, Bucket);
+}
+
+void FFlowTimerWheel::Link(const int32 TimerIndex, const int32 Bucket)
+{
+	FTimer& Timer = Timers[TimerIndex];
+	Timer.Bucket = Bucket;
+	Timer.Prev = INDEX_NONE;
+	Timer.Next = BucketHeads[Bucket];
+
+	if (Timer.Next != INDEX_NONE)
+	{
+		Timers[Timer.Next].Prev = TimerIndex;
+	}
+	BucketHeads[Bucket] = TimerIndex;
+}
+
+void FFlowTimerWheel::Unlink(const int32 TimerIndex)
+{
+	FTimer& Timer = Timers[TimerIndex];
+	if (Timer.Prev != INDEX_NONE)
+	{
+		Timers[Timer.Prev].Next = Timer.Next;
+	}
+	else
+	{
+		BucketHeads[Timer.Bucket] = Timer.Next;
+	}
+
+	if (Timer.Next != INDEX_NONE)
+	{
+		Timers[Timer.Next].Prev = Timer.Prev;
+	}
+
+	Timer.Bucket = INDEX_NONE;
+	Timer.Prev = INDEX_NONE;
+	Timer.Next = INDEX_NONE;
+}
+
+void FFlowTimerWheel::CascadeBucket(const int32 Bucket)
+{
+	int32 TimerIndex = BucketHeads[Bucket];
+	BucketHeads[Bucket] = INDEX_NONE;
+
+	while (TimerIndex != INDEX_NONE)
+	{
+		const int32 NextIndex = Timers[TimerIndex].Next;
+		Timers[TimerIndex].Prev = INDEX_NONE;
+		Timers[TimerIndex].Next = INDEX_NONE;
+
+		Schedule(TimerIndex);
+		TimerIndex = NextIndex;
+	}
+}
+
+void FFlowTimerWheel::CollectExpired(const int32 Bucket, const double Now, const bool bExpireAll, TArray<int32, TInlineAllocator<32>>& OutExpired)
+{
+	int32 TimerIndex = BucketHeads[Bucket];
+	while (TimerIndex != INDEX_NONE)
+	{
+		const int32 NextIndex = Timers[TimerIndex].Next;
+		if (bExpireAll || Timers[TimerIndex].ExpireTime <= Now)
+		{
+			Unlink(TimerIndex);
+			Timers[TimerIndex].State = ETimerState::Executing;
+			OutExpired.Add(TimerIndex);
+		}
+		TimerIndex = NextIndex;
+	}
+
+	// keep the FTimerManager order
+	OutExpired.Sort([this](const int32 A, const int32 B)
+	{
+		return Timers[A].ExpireTime < Timers[B].ExpireTime;
+	});
+}
+
+void FFlowTimerWheel::Execute(const int32 TimerIndex, const double Now)
+{
+	if (Timers[TimerIndex].State == ETimerState::ExecutingCleared)
+	{
+		// cleared by callback of another timer expiring in this tick
+		FreeTimer(TimerIndex);
+		return;
+	}
+
+	int32 CallCount = 1;
+	if (Timers[TimerIndex].bLoop)
+	{
+		FTimer& Timer = Timers[TimerIndex];
+		CallCount = FMath::TruncToInt32((Now - Timer.ExpireTime) / Timer.Rate) + 1;
+		Timer.ExpireTime += CallCount * Timer.Rate;
+	}
+
+	for (int32 CallIndex = 0; CallIndex < CallCount; CallIndex++)
+	{
+		// callback might set new timers, so don't keep a reference to the timer across calls
+		Timers[TimerIndex].Callback.ExecuteIfBound();
+
+		if (Timers[TimerIndex].State != ETimerState::Executing)
+		{
+			break;
+		}
+	}
+
+	FTimer& Timer = Timers[TimerIndex];
+	if (Timer.State == ETimerState::Executing && Timer.bLoop)
+	{
+		Timer.State = ETimerState::Scheduled;
+		Schedule(TimerIndex);
+	}
+	else
+	{
+		FreeTimer(TimerIndex);
+	}
+}
@@ -60,6 +60,10 @@ protected:
 		const FName& PinName,
 		const FProperty*& OutFoundProperty,
 		TInstancedStruct<FFlowDataPinValue>& OutFoundInstancedStruct) const override;
+	virtual bool TryFindPropertyViewByPinName(
+		const FName& PinName,
+		const FProperty*& OutFoundProperty,
+		const FFlowDataPinValue*& OutFoundValue) const override;
 	// --
 
 	// Operator classifiers
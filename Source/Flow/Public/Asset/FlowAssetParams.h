@@ -103,6 +103,12 @@ protected:
 
 	EFlowReconcilePropertiesResult CheckForParentCycle() const;
 
+	/* Loads the ParentParams chain once, starting from the direct parent. Fails on cyclic inheritance or unloadable parent. */
+	EFlowReconcilePropertiesResult GatherParentChain(TArray<UFlowAssetParams*, TInlineAllocator<8>>& OutParentChain) const;
+
+	/* Merges already flattened properties of the direct parent with local overrides. */
+	void ReconcilePropertiesWithParent(const UFlowAssetParams& Parent);
+
 	void ModifyAndRebuildPropertiesMap();
 	void RebuildPropertiesMap();
 #endif
@@ -12,6 +12,9 @@ struct FFlowDeferredTriggerInput
 	FGuid NodeGuid;
 	FName PinName;
 	FConnectedPin FromPin;
+
+	/* Index of the target node in the asset's execution plan, INDEX_NONE if not resolved. */
+	int32 NodeIndex = INDEX_NONE;
 };
 
 struct FLOW_API FFlowDeferredTransitionScope
@@ -23,6 +26,9 @@ public:
 	void CloseScope() { bIsOpen = false; }
 	bool IsOpen() const { return bIsOpen; }
 
+	/* Returns scope to the initial open state, keeping allocated memory for reuse. */
+	void ResetScope();
+
 	const TArray<FFlowDeferredTriggerInput>& GetDeferredTriggers() const { return DeferredTriggers; }
 
 protected:
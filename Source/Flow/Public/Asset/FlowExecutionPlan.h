@@ -0,0 +1,95 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Misc/Guid.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/NameTypes.h"
+
+#include "Nodes/FlowPin.h"
+
+class UFlowAsset;
+
+/**
+ * Exec connection resolved to the dense node index of the target node.
+ */
+struct FFlowExecutionPlanTarget
+{
+	int32 NodeIndex = INDEX_NONE;
+	FName PinName;
+};
+
+/**
+ * Output pin of a planned node, points to the contiguous range of its targets.
+ */
+struct FFlowExecutionPlanOutput
+{
+	FName PinName;
+	int32 FirstTarget = 0;
+	int32 NumTargets = 0;
+};
+
+/**
+ * Node entry in the plan, points to the contiguous range of its outputs.
+ * Outputs are stored in the same order as UFlowNode::OutputPins.
+ */
+struct FFlowExecutionPlanNode
+{
+	FGuid NodeGuid;
+	int32 FirstOutput = 0;
+	int32 NumOutputs = 0;
+};
+
+/**
+ * Immutable, index-based representation of exec connections in the Flow Asset template.
+ * It's built once per template and shared by all its instances, so triggering an output doesn't require hashing Guids or FNames.
+ * It also holds the reverse index of connections cached by nodes, answering "who connects into this pin" queries.
+ */
+struct FLOW_API FFlowExecutionPlan
+{
+public:
+	static TSharedRef<const FFlowExecutionPlan> Build(const UFlowAsset& TemplateAsset);
+
+	int32 GetNumNodes() const { return PlanNodes.Num(); }
+	const FGuid& GetNodeGuid(const int32 NodeIndex) const { return PlanNodes[NodeIndex].NodeGuid; }
+
+	/* Hashed lookup, intended for cold paths only (i.e. initializing instance, triggering input by Guid). */
+	int32 FindNodeIndex(const FGuid& NodeGuid) const;
+
+	/* Returns output at given index of the node, or nullptr if the plan doesn't know this pin (i.e. pins changed after building the plan). */
+	const FFlowExecutionPlanOutput* FindOutput(const int32 NodeIndex, const int32 OutputPinIndex, const FName& PinName) const;
+
+	TConstArrayView<FFlowExecutionPlanOutput> GetOutputs(const int32 NodeIndex) const
+	{
+		const FFlowExecutionPlanNode& PlanNode = PlanNodes[NodeIndex];
+		return TConstArrayView<FFlowExecutionPlanOutput>(Outputs.GetData() + PlanNode.FirstOutput, PlanNode.NumOutputs);
+	}
+
+	TConstArrayView<FFlowExecutionPlanTarget> GetTargets(const FFlowExecutionPlanOutput& Output) const
+	{
+		return TConstArrayView<FFlowExecutionPlanTarget>(Targets.GetData() + Output.FirstTarget, Output.NumTargets);
+	}
+
+	/* Nodes reachable from the default entry node, in the same order as UFlowAsset::GetNodesInExecutionOrder visits them.
+	 * Saving instances iterates it, instead of walking the graph on every save. */
+	TConstArrayView<int32> GetExecutionOrder() const { return ExecutionOrder; }
+
+	/* Returns pins connected into the given pin, in the same order as scanning UFlowNode::Connections of all nodes.
+	 * Intended for pins that aren't cached in the Connections map: exec inputs and data outputs. */
+	TConstArrayView<FConnectedPin> GetIncomingConnections(const FConnectedPin& ToPin) const;
+
+private:
+	TArray<FFlowExecutionPlanNode> PlanNodes;
+	TArray<FFlowExecutionPlanOutput> Outputs;
+	TArray<FFlowExecutionPlanTarget> Targets;
+
+	TMap<FGuid, int32> NodeIndexByGuid;
+
+	TArray<int32> ExecutionOrder;
+
+	/* Pin on the other end of a cached connection -> pins connected into it. */
+	TMap<FConnectedPin, TArray<FConnectedPin>> IncomingConnections;
+
+	void BuildExecutionOrder(const UFlowAsset& TemplateAsset);
+};
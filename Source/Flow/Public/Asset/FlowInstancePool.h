@@ -0,0 +1,63 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+#pragma once
+
+#include "UObject/ObjectPtr.h"
+
+#include "FlowInstancePool.generated.h"
+
+class UFlowAsset;
+
+/**
+ * Opt-in recycling of finished Flow Asset instances, configured per template asset.
+ * Only nodes declaring that they reset their runtime state are reused, see UFlowNode::CanBeReusedByInstancePool().
+ * These go through DeinitializeInstance and InitializeInstance again, just like nodes activated repeatedly in a loop.
+ * Other nodes of the recycled instance are created again from the template, so they start exactly like in a new instance.
+ */
+USTRUCT()
+struct FLOW_API FFlowInstancePoolSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Instance Pool")
+	bool bEnabled = false;
+
+	/* Finished instances exceeding this number are released, as they would be without pooling. */
+	UPROPERTY(EditAnywhere, Category = "Instance Pool", meta = (EditCondition = "bEnabled", ClampMin = 1))
+	int32 MaxPooledInstances = 4;
+
+	/* Number of instances created upfront, when the first instance of this asset is requested. */
+	UPROPERTY(EditAnywhere, Category = "Instance Pool", meta = (EditCondition = "bEnabled", ClampMin = 0))
+	int32 WarmUpInstances = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FLOW_API FFlowInstancePoolStats
+{
+	GENERATED_BODY()
+
+	/* Instances currently waiting for reuse. */
+	UPROPERTY(BlueprintReadOnly, Category = "Instance Pool")
+	int32 NumPooled = 0;
+
+	/* Requested instances served from the pool. */
+	UPROPERTY(BlueprintReadOnly, Category = "Instance Pool")
+	int32 NumHits = 0;
+
+	/* Requested instances that had to be created, since the pool was empty. */
+	UPROPERTY(BlueprintReadOnly, Category = "Instance Pool")
+	int32 NumMisses = 0;
+};
+
+/**
+ * Finished instances of a single template asset, kept by the Flow Subsystem.
+ */
+USTRUCT()
+struct FLOW_API FFlowInstancePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UFlowAsset>> FreeInstances;
+
+	FFlowInstancePoolStats Stats;
+};
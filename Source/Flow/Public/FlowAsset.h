@@ -5,7 +5,10 @@
 #include "FlowTypes.h"
 #include "Asset/FlowAssetParamsTypes.h"
 #include "Asset/FlowDeferredTransitionScope.h"
+#include "Asset/FlowExecutionPlan.h"
+#include "Asset/FlowInstancePool.h"
 #include "Nodes/FlowNode.h"
+#include "Policies/FlowPreloadLookahead.h"
 
 #if WITH_EDITOR
 #include "FlowMessageLog.h"
@@ -69,6 +72,8 @@ public:
 	// UObject
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
+	virtual void PostTransacted(const FTransactionObjectEvent& TransactionEvent) override;
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 	virtual void PostLoad() override;
 	virtual void PreSaveRoot(FObjectPreSaveRootContext ObjectSaveContext) override;
@@ -284,6 +289,14 @@ protected:
 //////////////////////////////////////////////////////////////////////////
 // Instances of the template asset
 
+protected:
+	/* Opt-in recycling of finished instances by the Flow Subsystem, reduces object churn of short-lived graphs. */
+	UPROPERTY(EditAnywhere, Category = "Instance Pool")
+	FFlowInstancePoolSettings InstancePoolSettings;
+
+public:
+	const FFlowInstancePoolSettings& GetInstancePoolSettings() const { return InstancePoolSettings; }
+
 private:
 	/* Original object holds references to instances. */
 	UPROPERTY(Transient)
@@ -346,24 +359,52 @@ protected:
 	UPROPERTY()
 	TSet<TObjectPtr<UFlowNode_CustomInput>> CustomInputNodes;
 
-	/* Nodes that have any work left, not marked as Finished yet. */
+	/* CustomInputNodes indexed by EventName, built in InitializeInstance. Multiple nodes may listen to the same event. */
+	TMap<FName, FlowArray::TInlineArray<UFlowNode_CustomInput*, 1>> CustomInputNodesByEventName;
+
+	/* Nodes that have any work left, not marked as Finished yet. Kept in activation order.
+	 * Every active node knows its index here, so membership check doesn't search the array. */
 	UPROPERTY()
 	TArray<TObjectPtr<UFlowNode>> ActiveNodes;
 
-	/* All nodes active in the past, done their work. */
+	/* All nodes active in the past, done their work. Every node is recorded once, in order of its first activation. */
 	UPROPERTY()
 	TArray<TObjectPtr<UFlowNode>> RecordedNodes;
 
 	UPROPERTY(Transient)
 	EFlowFinishPolicy FinishPolicy;
 
+	/* Compiled exec connections. Built once by the template and shared with all its instances. */
+	mutable TSharedPtr<const FFlowExecutionPlan> ExecutionPlan;
+
+	/* Node instances indexed the same way as nodes in the ExecutionPlan. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UFlowNode>> NodesByPlanIndex;
+
 public:
 	virtual void InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlowAsset& InTemplateAsset);
 	virtual void DeinitializeInstance();
 	bool IsInstanceInitialized() const { return IsValid(TemplateAsset); }
 
+protected:
+	/* Creates node instances. Recycled instance creates again only nodes which can't be reused, see UFlowNode::CanBeReusedByInstancePool(). */
+	void InstantiateNodes();
+
+	/* Called by the Flow Subsystem once this instance is kept in the instance pool. */
+	void OnAddedToInstancePool();
+
+public:
+
 	UFlowAsset* GetTemplateAsset() const { return TemplateAsset; }
 
+	/* Returns the plan compiled from template's exec connections. Built on the first call and reused by every instance. */
+	TSharedRef<const FFlowExecutionPlan> GetOrBuildExecutionPlan() const;
+
+#if WITH_EDITOR
+	/* Discards the compiled plan, so it will be rebuilt with the current connections. Instances already running keep their plan. */
+	void InvalidateExecutionPlan() { ExecutionPlan.Reset(); }
+#endif
+
 	/* Object that spawned Root Flow instance, i.e. World Settings or Player Controller.
 	 * This pointer is passed to child instances: Flow Asset instances created by the SubGraph nodes. */
 	UFUNCTION(BlueprintPure, Category = "Flow")
@@ -386,6 +427,15 @@ public:
 protected:
 	virtual void FinishNode(UFlowNode* Node);
 	void ResetNodes();
+
+	/* Returns false if the node was already active. */
+	bool AddActiveNode(UFlowNode* Node);
+
+	/* Returns false if the node wasn't active. */
+	bool RemoveActiveNode(UFlowNode* Node);
+
+	/* Adds node to RecordedNodes, unless it has been recorded already. */
+	void AddRecordedNode(UFlowNode* Node);
 	
 public:	
 	virtual void FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool bRemoveInstance = true);
@@ -423,6 +473,11 @@ protected:
 	/* Override these functions to set up unique policy(ies) for a UFlowAsset subclass. */
 	virtual void InitializePreloadPolicy();
 
+	/* Preloads and flushes nodes using lookahead timings, as the set of active nodes changes. */
+	FFlowPreloadLookahead PreloadLookahead;
+
+	void UpdatePreloadLookahead();
+
 public:
 	const FFlowPreloadPolicy& GetPreloadPolicy() const;
 
@@ -439,25 +494,41 @@ protected:
 	 * Stored as TSharedPtr so callers can safely cache a reference to a specific scope
 	 * without it being invalidated by array reallocations/resizes during nested triggers. */
 	TArray<TSharedPtr<FFlowDeferredTransitionScope>> DeferredTransitionScopes;
+
+	/* Flushed scopes kept for reuse, so pushing a scope for every triggered input doesn't allocate memory.
+	 * Its size is limited by the deepest nesting of scopes reached by this instance. */
+	TArray<TSharedPtr<FFlowDeferredTransitionScope>> DeferredTransitionScopePool;
 	
 public:	
 	void TriggerCustomInput(const FName& EventName, IFlowDataPinValueSupplierInterface* DataPinValueSupplier = nullptr);
 
+	/* Triggers many Custom Inputs at once. Outputs triggered by them are flushed together, after all events have been dispatched.
+	 * Events are dispatched in the given order. */
+	void TriggerCustomInputs(TConstArrayView<FName> EventNames, IFlowDataPinValueSupplierInterface* DataPinValueSupplier = nullptr);
+
 	void TriggerCustomInput_FromSubGraph(UFlowNode_SubGraph* Node, const FName& EventName) const;
 	void TriggerCustomOutput(const FName& EventName);
 
 	/* todo: Extend FromPin through to Node level Trigger functions. */
 	virtual void TriggerInput(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin);
-	
+
+	/* Trigger input already resolved by the execution plan, it doesn't need to look up node by Guid. */
+	void TriggerInputByIndex(const FFlowDeferredTriggerInput& Trigger);
+
 protected:
+	/* Triggers all inputs connected to the given output of the node, using the execution plan if possible. */
+	void TriggerConnectedInputs(const UFlowNode& FromNode, const int32 OutputPinIndex, const FName& PinName);
+
+	void ExecuteCustomInputNodes(const FName& EventName, IFlowDataPinValueSupplierInterface* DataPinValueSupplier);
+
 	/* Trigger the node directly (no deferral, no new scope). */
-	void TriggerInputDirect(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin);
+	void TriggerInputDirect(const FFlowDeferredTriggerInput& Trigger);
 	
 	/* Allow subclasses to disable the standard defer trigger mechanism */
 	virtual bool ShouldDeferTriggers() const;
 
 protected:
-	void EnqueueDeferredTrigger(const FGuid& NodeGuid, const FName& PinName, const FConnectedPin& FromPin);
+	void EnqueueDeferredTrigger(const FFlowDeferredTriggerInput& Trigger);
 	TSharedPtr<FFlowDeferredTransitionScope> PushDeferredTransitionScope();
 	void PopDeferredTransitionScope(const TSharedPtr<FFlowDeferredTransitionScope>& Scope);
 
@@ -500,7 +571,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	void LoadInstance(const FFlowAssetSaveData& AssetRecord);
 
+	/* Called by nodes whose state changed, and whenever the set of active nodes changes. */
+	void MarkSaveDirty() { bSaveDirty = true; }
+
 protected:
+	/* True if anything changed since the previous save, so node records have to be gathered again. */
+	bool bSaveDirty = true;
+
+	/* Node records written by the previous save. Reused as a whole if nothing changed and every saved node caches its data. */
+	TArray<FFlowNodeSaveData> CachedNodeRecords;
+	FGuid CachedNodeRecordsFormatId;
+	bool bCachedNodeRecordsReusable = false;
+
+	/* SubGraph nodes saved by the previous save, their instances are saved again even if reusing CachedNodeRecords. */
+	TArray<TWeakObjectPtr<UFlowNode_SubGraph>> CachedSavedSubGraphs;
+
+	void SaveSubFlowInstance(UFlowNode_SubGraph& SubGraphNode, TArray<FFlowAssetSaveData>& SavedFlowInstances);
+
 	virtual void OnActivationStateLoaded(UFlowNode* Node);
 
 	UFUNCTION(BlueprintNativeEvent, Category = "SaveGame")
@@ -214,6 +214,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RootFlow")
 	void TriggerRootFlowCustomInput(const FName& EventName) const;
 
+	/* This will trigger many CustomInputs on this component's root flow, in the given order, within a single call. */
+	UFUNCTION(BlueprintCallable, Category = "RootFlow")
+	void TriggerRootFlowCustomInputs(const TArray<FName>& EventNames) const;
+
 	/* Called when a Root flow asset triggers a CustomOutput. */
 	UFUNCTION(BlueprintImplementableEvent, DisplayName = "OnRootFlowCustomEvent")
 	void BP_OnRootFlowCustomEvent(UFlowAsset* RootFlowInstance, const FName& EventName);
@@ -236,12 +240,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	virtual void LoadRootFlow();
 
+protected:
+	void SetSavedAssetInstanceName(const FString& InstanceName);
+
+public:
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	FFlowComponentSaveData SaveInstance();
 
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	bool LoadInstance(const UFlowSubsystem* FlowSubsystem);
 
+	/* Forces component to be serialized again on the next save. Needed only with bCacheSaveData enabled. */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	void MarkSaveDirty() { bSaveDirty = true; }
+
+protected:
+	/* If enabled, component is serialized only if MarkSaveDirty() was called since the previous save, otherwise saved data is reused.
+	 * Enable only if every change of SaveGame properties in this component class is followed by MarkSaveDirty(). */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay, Category = "SaveGame")
+	bool bCacheSaveData = false;
+
+private:
+	bool bSaveDirty = true;
+
+	/* ComponentData written by the previous save, kept only with bCacheSaveData enabled. */
+	TArray<uint8> CachedSaveData;
+	FGuid CachedSaveFormatId;
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "SaveGame")
 	void OnSave();
@@ -2,5 +2,8 @@
 #pragma once
 
 #include "Logging/LogMacros.h"
+#include "Stats/Stats.h"
 
 FLOW_API DECLARE_LOG_CATEGORY_EXTERN(LogFlow, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("Flow"), STATGROUP_Flow, STATCAT_Advanced);
@@ -73,6 +73,134 @@ struct FLOW_API FFlowArchive : public FObjectAndNameAsStringProxyArchive
 	}
 };
 
+/**
+ * Strings shared by all records of a single save, i.e. names and object paths written by FFlowCompactArchive.
+ * Entries are only appended, so data written earlier stays valid while more data is written.
+ */
+USTRUCT(BlueprintType)
+struct FLOW_API FFlowSaveNameTable
+{
+	GENERATED_USTRUCT_BODY()
+
+	int32 FindOrAdd(const FString& String);
+	const FString* Find(const int32 Index) const { return Entries.IsValidIndex(Index) ? &Entries[Index] : nullptr; }
+
+	int32 Num() const { return Entries.Num(); }
+	bool IsEmpty() const { return Entries.IsEmpty(); }
+
+	/* Identifies the table, so data cached by the previous save is reused only if it was written with the same table. */
+	const FGuid& GetId() const { return Id; }
+	void InitializeId() { if (!Id.IsValid()) { Id = FGuid::NewGuid(); } }
+
+private:
+	UPROPERTY(SaveGame, VisibleAnywhere, Category = "Flow")
+	FGuid Id;
+
+	UPROPERTY(SaveGame, VisibleAnywhere, Category = "Flow")
+	TArray<FString> Entries;
+
+	/* Built on the first write, tables loaded from the save are used only for reading. */
+	TMap<FString, int32> EntryIndices;
+
+	/* Loading rejects entry count larger than the data left in the archive. */
+	void SerializeEntries(FArchive& Ar);
+
+public:
+	friend FArchive& operator<<(FArchive& Ar, FFlowSaveNameTable& InNameTable)
+	{
+		InNameTable.SerializeEntries(Ar);
+		return Ar;
+	}
+};
+
+/**
+ * Archive writing names and object paths as indices to FFlowSaveNameTable, instead of repeating full strings in every record.
+ * Use FlowSave::WriteObject() and FlowSave::ReadObject(), which tell apart data written by this archive and by FFlowArchive.
+ */
+struct FLOW_API FFlowCompactArchive : public FFlowArchive
+{
+	/* Saving, adds new entries to the table. */
+	FFlowCompactArchive(FArchive& InInnerArchive, FFlowSaveNameTable& InNameTable);
+
+	/* Loading. */
+	FFlowCompactArchive(FArchive& InInnerArchive, const FFlowSaveNameTable& InNameTable);
+
+	virtual FArchive& operator<<(FName& Value) override;
+	virtual FArchive& operator<<(UObject*& Value) override;
+	virtual FArchive& operator<<(FObjectPtr& Value) override;
+	virtual FString GetArchiveName() const override { return TEXT("FFlowCompactArchive"); }
+
+private:
+	FFlowSaveNameTable* WritableNameTable;
+	const FFlowSaveNameTable& NameTable;
+
+	void SerializeTableEntry(FString& Value);
+};
+
+namespace FlowSave
+{
+	/* Serializes SaveGame properties of the object. Names and object paths are added to NameTable if given, otherwise written as strings. */
+	FLOW_API void WriteObject(UObject& Object, TArray<uint8>& OutData, FFlowSaveNameTable* NameTable);
+
+	/* Reads data written by WriteObject() in any format.
+	 * Returns false if data requires a name table, and NameTable isn't given or isn't the table the data was written with. */
+	FLOW_API bool ReadObject(UObject& Object, const TArray<uint8>& Data, const FFlowSaveNameTable* NameTable);
+
+	/* Returns id of data written with the given table, invalid for data written as strings. */
+	inline FGuid GetFormatId(const FFlowSaveNameTable* NameTable) { return NameTable ? NameTable->GetId() : FGuid(); }
+
+	/* Returns false if the number of elements read from the archive is negative, or larger than the number of bytes left in the archive.
+	 * Check it before allocating elements, so corrupted data fails to load instead of requesting a huge allocation. */
+	FLOW_API bool IsValidLoadedNum(FArchive& Ar, const int64 Num);
+
+	/* Returns true if data written by WriteObject() needs the table of given id to be read. Reads only the header of the data. */
+	FLOW_API bool IsWrittenWithNameTable(const TArray<uint8>& Data, const FGuid& TableId);
+}
+
+class UFlowSaveGame;
+
+/**
+ * Hashed lookup of records stored in the Flow save data, so restoring a component or Flow Asset instance doesn't scan every record.
+ * Keys are hashes of record identity strings, compared case-insensitively like FString::operator==.
+ * Always resolves to the first matching record, exactly like scanning the record arrays in order.
+ */
+struct FLOW_API FFlowSaveGameIndex
+{
+public:
+	void Build(const UFlowSaveGame& SaveGame);
+
+	/* Indexes records owned by the save game, but stored elsewhere for now, i.e. lent to the encoding task of UFlowSubsystem::OnGameSavedAsync().
+	 * Index stays valid once records are moved back to the save game unchanged. */
+	void Build(const UFlowSaveGame& SaveGame, const TArray<FFlowComponentSaveData>& FlowComponents, const TArray<FFlowAssetSaveData>& FlowInstances);
+
+	void Reset();
+
+	/* False if built for another save game, or records were added or removed since.
+	 * Records modified without changing their number aren't detected, call Reset() after modifying records in place. */
+	bool IsUpToDate(const UFlowSaveGame& SaveGame) const;
+	bool IsUpToDate(const UFlowSaveGame& SaveGame, const TArray<FFlowComponentSaveData>& FlowComponents, const TArray<FFlowAssetSaveData>& FlowInstances) const;
+
+	const FFlowComponentSaveData* FindComponentRecord(const UFlowSaveGame& SaveGame, const FString& WorldName, const FString& ActorInstanceName) const;
+	const FFlowComponentSaveData* FindComponentRecord(const TArray<FFlowComponentSaveData>& FlowComponents, const FString& WorldName, const FString& ActorInstanceName) const;
+
+	/* Pass null WorldName to find record of a Flow Asset not bound to any world. */
+	const FFlowAssetSaveData* FindAssetRecord(const UFlowSaveGame& SaveGame, const FString& InstanceName, const FString* WorldName) const;
+	const FFlowAssetSaveData* FindAssetRecord(const TArray<FFlowAssetSaveData>& FlowInstances, const FString& InstanceName, const FString* WorldName) const;
+
+private:
+	TWeakObjectPtr<const UFlowSaveGame> IndexedSaveGame;
+	int32 NumIndexedComponents = 0;
+	int32 NumIndexedInstances = 0;
+
+	/* Key hash -> indices of records with this hash, in ascending order. */
+	TMultiMap<uint32, int32> ComponentRecords;
+	TMultiMap<uint32, int32> InstanceRecordsByName;
+	TMultiMap<uint32, int32> InstanceRecordsByNameAndWorld;
+
+	static uint32 GetComponentKeyHash(const FString& WorldName, const FString& ActorInstanceName);
+	static uint32 GetInstanceKeyHash(const FString& InstanceName, const FString* WorldName);
+};
+
 UCLASS(BlueprintType)
 class FLOW_API UFlowSaveGame : public USaveGame
 {
@@ -89,11 +217,18 @@ public:
 
 	UPROPERTY(VisibleAnywhere, Category = "Flow")
 	TArray<FFlowAssetSaveData> FlowInstances;
+
+	/* Names and object paths referenced by records written in the compact format. Empty if compact format isn't used. */
+	UPROPERTY(VisibleAnywhere, Category = "Flow")
+	FFlowSaveNameTable NameTable;
 	
 	friend FArchive& operator<<(FArchive& Ar, UFlowSaveGame& SaveGame)
 	{
-		Ar << SaveGame.FlowComponents;
-		Ar << SaveGame.FlowInstances;
+		SaveGame.SerializeRecords(Ar);
 		return Ar;
 	}
+
+private:
+	/* Data written before the name table was added starts with the number of component records, newer data starts with a negative marker and version. */
+	void SerializeRecords(FArchive& Ar);
 };
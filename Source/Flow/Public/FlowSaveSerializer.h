@@ -0,0 +1,59 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+#pragma once
+
+#include "FlowSave.h"
+
+/**
+ * Plain copy of Flow save records, captured on the game thread.
+ * It doesn't reference any UObject, so it's safe to encode it on any thread.
+ */
+struct FLOW_API FFlowSaveSnapshot
+{
+	TArray<FFlowComponentSaveData> FlowComponents;
+	TArray<FFlowAssetSaveData> FlowInstances;
+	FFlowSaveNameTable NameTable;
+};
+
+DECLARE_DELEGATE_TwoParams(FFlowSaveEncodedDelegate, const bool /*bSuccess*/, const TArray<uint8>& /*EncodedData*/);
+
+/**
+ * Encodes Flow save records into a single compressed blob, ready to be written to disk, and decodes it back.
+ * Encoding reads only FFlowSaveSnapshot, so the archive encoding and compression can run on a worker thread while the game goes on.
+ */
+class FLOW_API FFlowSaveSerializer
+{
+public:
+	/* Can be called from any thread. */
+	static bool Encode(const FFlowSaveSnapshot& Snapshot, TArray<uint8>& OutData);
+
+	/* Can be called from any thread. Returns false if data is corrupted or written by unsupported version. */
+	static bool Decode(const TArray<uint8>& Data, FFlowSaveSnapshot& OutSnapshot);
+
+	/* Encodes snapshot on a worker thread. OnCompleted is called on the game thread. */
+	static void EncodeAsync(FFlowSaveSnapshot&& Snapshot, FFlowSaveEncodedDelegate&& OnCompleted);
+
+	/* Shared snapshot can be read by the game thread while the worker encodes it, but must not be modified until OnCompleted is called.
+	 * The worker stops reading it and releases its reference before OnCompleted is called, so records can be moved out of the snapshot then. */
+	static void EncodeAsync(const TSharedRef<const FFlowSaveSnapshot, ESPMode::ThreadSafe>& Snapshot, FFlowSaveEncodedDelegate&& OnCompleted);
+
+private:
+	static constexpr uint32 Magic = 0x56534C46; // "FLSV"
+
+	/* Decoding rejects data claiming a larger size, instead of allocating whatever corrupted data asks for. */
+	static constexpr int32 MaxUncompressedSize = 256 * 1024 * 1024;
+
+	static void SerializeTaggedRecords(FArchive& Ar, FFlowSaveSnapshot& Snapshot);
+	static void SerializeCompactRecords(FArchive& Ar, FFlowSaveSnapshot& Snapshot);
+
+	enum class EVersion : int32
+	{
+		Initial = 1,
+
+		/* Records written in a fixed layout instead of tagged properties, with world and instance names and node Guids deduplicated. */
+		CompactRecords,
+
+		// -----<new versions can be added above this line>-----
+		VersionPlusOne,
+		Latest = VersionPlusOne - 1
+	};
+};
@@ -63,6 +63,11 @@ public:
 	FFlowSettingsEvent OnAdaptiveNodeTitlesChanged;
 #endif
 
+	/* If enabled, Branch, Switch and composite predicates memoize data pin values while evaluating, so predicates reading the same upstream pin ask its supplier once.
+	 * Enable it only if suppliers return the same value when asked again within a single evaluation. */
+	UPROPERTY(EditAnywhere, Config, Category = "Nodes")
+	bool bCacheDataPinValuesWhileEvaluating;
+
 	/* Default class to use as a FlowAsset's "ExpectedOwnerClass". */
 	UPROPERTY(EditAnywhere, Config, Category = "Nodes")
 	FSoftClassPath DefaultExpectedOwnerClass;
@@ -70,6 +75,11 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem")
 	bool bWarnAboutMissingIdentityTags;
 
+	/* If enabled, names and object paths in data saved to UFlowSaveGame are written once to its name table, and records refer to them by index.
+	 * Saves written with this option disabled, or before it existed, can still be loaded. */
+	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem")
+	bool bCompactSaveData;
+
 public:
 	UClass* GetDefaultExpectedOwnerClass() const;
 
@@ -4,11 +4,17 @@
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/ObjectKey.h"
 
+#include "Asset/FlowInstancePool.h"
 #include "FlowComponent.h"
+#include "FlowSaveSerializer.h"
+#include "Types/FlowArray.h"
+#include "Types/FlowTimerWheel.h"
 #include "FlowSubsystem.generated.h"
 
 class IFlowDataPinValueSupplierInterface;
+class UFlowNode_ComponentObserver;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSimpleFlowEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSimpleFlowComponentEvent, UFlowComponent*, Component);
@@ -51,6 +57,9 @@ protected:
 	UPROPERTY()
 	TMap<TObjectPtr<UFlowAsset>, TWeakObjectPtr<UObject>> RootInstances;
 
+	/* RootInstances indexed by owner, in order of creation. Modify only via AddRootInstance and RemoveRootInstance. */
+	TMap<FObjectKey, FlowArray::TInlineArray<UFlowAsset*, 1>> RootInstancesByOwner;
+
 	/* Assets instanced by Sub Graph nodes */
 	UPROPERTY()
 	TMap<TObjectPtr<UFlowNode_SubGraph>, TObjectPtr<UFlowAsset>> InstancedSubFlows;
@@ -87,6 +96,9 @@ public:
 	virtual void FinishAllRootFlows(UObject* Owner, const EFlowFinishPolicy FinishPolicy);
 
 protected:
+	void AddRootInstance(UFlowAsset* Instance, UObject* Owner);
+	void RemoveRootInstance(UFlowAsset* Instance);
+
 	UFlowAsset* CreateSubFlow(UFlowNode_SubGraph* SubGraphNode, const FString& SavedInstanceName = FString(), const bool bPreloading = false);
 	void RemoveSubFlow(UFlowNode_SubGraph* SubGraphNode, const EFlowFinishPolicy FinishPolicy);
 
@@ -97,6 +109,37 @@ protected:
 	virtual void AddInstancedTemplate(UFlowAsset* Template);
 	virtual void RemoveInstancedTemplate(UFlowAsset* Template);
 
+//////////////////////////////////////////////////////////////////////////
+// Instance pooling
+
+protected:
+	/* Finished instances kept for reuse, only for template assets with enabled InstancePoolSettings.
+	 * Pooled instances don't keep their template loaded, pools of unloaded templates are dropped. */
+	UPROPERTY(Transient)
+	TMap<TWeakObjectPtr<UFlowAsset>, FFlowInstancePool> InstancePools;
+
+	FFlowInstancePool& FindOrAddInstancePool(UFlowAsset& TemplateAsset);
+
+	/* Pooled instances have distinct names, so they don't block restoring an instance with the same name from the SaveGame. */
+	FName MakePooledInstanceName(const UFlowAsset& TemplateAsset);
+
+	/* Returns recycled instance, or nullptr if the pool is disabled or empty. */
+	UFlowAsset* TryAcquirePooledInstance(UFlowAsset& TemplateAsset);
+
+	/* Called by the instance after it has been deinitialized. Returns true if the instance has been kept for reuse. */
+	virtual bool ReleaseInstanceToPool(UFlowAsset& TemplateAsset, UFlowAsset& Instance);
+
+public:
+	/* Creates instances upfront, until the pool holds WarmUpInstances of given asset. Called automatically on the first request for an instance. */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
+	void WarmUpInstancePool(UFlowAsset* TemplateAsset);
+
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem")
+	FFlowInstancePoolStats GetInstancePoolStats(UFlowAsset* TemplateAsset) const;
+
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
+	void ClearInstancePools();
+
 public:
 	/* Try to flush (and clear) all Deferred Trigger scopes.
 	 * (can fail to flush all if a FFlowExecutionGate causes a new halt) */
@@ -114,6 +157,8 @@ public:
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem")
 	TSet<UFlowAsset*> GetRootInstancesByOwner(const UObject* Owner) const;
 
+	bool IsRootInstance(UFlowAsset* Instance) const { return RootInstances.Contains(Instance); }
+
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeprecatedFunction, DeprecationMessage="Use GetRootInstancesByOwner() instead."))
 	UFlowAsset* GetRootFlow(const UObject* Owner) const;
 
@@ -122,6 +167,17 @@ public:
 	const TMap<UFlowNode_SubGraph*, UFlowAsset*>& GetInstancedSubFlows() const { return ObjectPtrDecay(InstancedSubFlows); }
 
 
+//////////////////////////////////////////////////////////////////////////
+// Timers
+
+protected:
+	/* Timer wheels driving Flow timers, one per world */
+	TMap<FObjectKey, TUniquePtr<FFlowTimerWheel>> TimerWheels;
+
+public:
+	/* Returns timer wheel of the given world, creates it on first use. */
+	FFlowTimerWheel* GetTimerWheel(UWorld* World);
+
 //////////////////////////////////////////////////////////////////////////
 // SaveGame support
 
@@ -129,6 +185,44 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UFlowSaveGame> LoadedSaveGame;
 
+	/* Names and object paths written in the compact format during this session. Only appended, so node data cached by previous saves stays valid.
+	 * Replaced by an empty table with a new id once most of its entries aren't used by saved data anymore, see RotateSaveNameTableIfStale(). */
+	FFlowSaveNameTable SaveNameTable;
+
+	/* Number of SaveNameTable entries written by the first save with this table, all of them referenced by that save. */
+	int32 NumSaveNamesInUse = 0;
+
+	/* Starts a new table, if it holds twice as many entries as saved data used when the table started.
+	 * Following save writes all data again, as data cached with the previous table can't be reused. */
+	void RotateSaveNameTableIfStale();
+
+	/* Returns true if records kept in the container while saving, i.e. records of other worlds, need its own name table. */
+	bool AreKeptRecordsUsingOwnNameTable(const UFlowSaveGame& SaveGame) const;
+
+	/* Table used by the save currently in progress, if saving in the compact format. */
+	FFlowSaveNameTable* ActiveSaveNameTable = nullptr;
+
+	/* Hashed lookup of LoadedSaveGame records. Built when save is loaded, rebuilt on lookup if records were added or removed since. */
+	mutable FFlowSaveGameIndex LoadedSaveGameIndex;
+
+	const FFlowSaveGameIndex& GetLoadedSaveGameIndex() const;
+
+	/* Records and name tables of save game containers, lent to encoding tasks started by OnGameSavedAsync(). Returned to the container once encoded.
+	 * Read-only while lent, as a worker thread reads them. Lookups of the loaded save game read them meanwhile. */
+	TMap<TObjectKey<UFlowSaveGame>, TSharedRef<FFlowSaveSnapshot, ESPMode::ThreadSafe>> LentSaveRecords;
+
+	const FFlowSaveSnapshot* FindLentSaveRecords(const UFlowSaveGame& SaveGame) const;
+
+	/* Copies lent records back to the container, so saving into it again before encoding completes keeps records of other worlds. */
+	void ReclaimLentSaveRecords(UFlowSaveGame& SaveGame);
+
+	/* Moves records back to the container once encoded, unless the container reclaimed them already. */
+	void ReturnLentSaveRecords(const TObjectKey<UFlowSaveGame> SaveGameKey, const TSharedRef<FFlowSaveSnapshot, ESPMode::ThreadSafe>& Snapshot);
+
+	/* Records of LoadedSaveGame, also while lent to the encoding task. LoadedSaveGame must be valid. */
+	const TArray<FFlowComponentSaveData>& GetLoadedComponentRecords() const;
+	const TArray<FFlowAssetSaveData>& GetLoadedAssetRecords() const;
+
 public:
 	UPROPERTY(BlueprintAssignable, Category = "FlowSubsystem")
 	FSimpleFlowEvent OnSaveGame;
@@ -143,6 +237,16 @@ public:
 
 	virtual void OnGameLoaded(TArray<FFlowComponentSaveData>& FlowComponents, TArray<FFlowAssetSaveData>& FlowInstances);
 
+	/* Saves Flow data like OnGameSaved(), then encodes and compresses the records on a worker thread.
+	 * Serializing Flow Assets, nodes and components into records stays on the game thread, as it reads UObjects. Only packing the records into a single blob and compressing it runs on the worker.
+	 * OnCompleted is called on the game thread with data ready to be written to disk. Pass this data to OnGameLoadedFromData() to restore it.
+	 * Records and name table of the SaveGame container are lent to the worker, not copied. Container arrays stay empty until the records are returned, right before OnCompleted is called.
+	 * Lookups of the loaded save game and saving into the same container again still see the lent records meanwhile. */
+	virtual void OnGameSavedAsync(UFlowSaveGame* SaveGame, FFlowSaveEncodedDelegate OnCompleted);
+
+	/* Decodes data written by OnGameSavedAsync() into a new loaded save game, then calls OnGameLoaded() with its records. Returns false if data couldn't be decoded. */
+	virtual bool OnGameLoadedFromData(const TArray<uint8>& EncodedData);
+
 	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
 	virtual void LoadRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const FString& SavedAssetInstanceName, const bool bAllowMultipleInstances);
 
@@ -158,6 +262,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
 	virtual void ClearLoadedSaveGame();
 
+	/* Returns table to write names and object paths to, or null if save data should be written as strings. */
+	FFlowSaveNameTable* GetActiveSaveNameTable() const { return ActiveSaveNameTable; }
+
+	/* Returns table needed to read data saved in the compact format. */
+	const FFlowSaveNameTable* GetLoadedSaveNameTable() const;
+
 //////////////////////////////////////////////////////////////////////////
 // Component Registry
 
@@ -165,6 +275,30 @@ protected:
 	/* All the Flow Components currently existing in the world */
 	TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>> FlowComponentRegistry;
 
+	/* Every entry of FlowComponentRegistry added also under all parent tags of its tag.
+	 * Allows for non-exact queries without scanning the entire registry. */
+	TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>> FlowComponentHierarchyRegistry;
+
+	/* Keep both registries consistent, use these instead of modifying the registries directly. */
+	void AddToComponentRegistry(const FGameplayTag& Tag, UFlowComponent* Component);
+	void RemoveFromComponentRegistry(const FGameplayTag& Tag, UFlowComponent* Component);
+
+	/* Active Component Observers indexed by each of their Identity Tags.
+	 * Registry changes are dispatched natively only to observers interested in affected tags, instead of broadcasting to every observer in the world. */
+	TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowNode_ComponentObserver>> ComponentObserverRegistry;
+
+	/* Tags each observer is indexed under, so it's removed from exactly these keys even if its Identity Tags changed since. */
+	TMap<TWeakObjectPtr<UFlowNode_ComponentObserver>, FGameplayTagContainer> ComponentObserverTags;
+
+	/* Calls Notify on every observer indexed under affected tags or their parent tags. Observer might get notified despite not matching tags, it's expected to filter events itself. */
+	void NotifyComponentObservers(const FGameplayTagContainer& AffectedTags, TFunctionRef<void(UFlowNode_ComponentObserver&)> Notify) const;
+
+public:
+	/* Indexes observer under given tags. Observer already indexed under other tags is re-keyed.
+	 * Changing observer's tags doesn't affect the index until it's added again. */
+	void AddComponentObserver(UFlowNode_ComponentObserver* Observer, const FGameplayTagContainer& ObservedTags);
+	void RemoveComponentObserver(UFlowNode_ComponentObserver* Observer);
+
 protected:
 	virtual void RegisterComponent(UFlowComponent* Component);
 	virtual void OnIdentityTagAdded(UFlowComponent* Component, const FGameplayTag& AddedTag);
@@ -198,7 +332,7 @@ public:
 	 * 
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ComponentClass Only components matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ComponentClass"))
 	TSet<UFlowComponent*> GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
@@ -209,7 +343,7 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ComponentClass Only components matching this class we'll be returned
-	* @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	* @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ComponentClass"))
 	TSet<UFlowComponent*> GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
@@ -219,7 +353,7 @@ public:
 	 * 
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TSet<AActor*> GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
@@ -230,7 +364,7 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TSet<AActor*> GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
@@ -240,7 +374,7 @@ public:
 	 * 
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
@@ -251,7 +385,7 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ActorClass Only actors matching this class we'll be returned
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
 	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
@@ -261,27 +395,19 @@ public:
 	 * 
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTag& Tag, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
 
-		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent<T>(Tag, bExactMatch, [&Result](T& Component)
 		{
-			if (Component.IsValid())
-			{
-				if (T* ComponentOfClass = Cast<T>(Component))
-				{
-					Result.Emplace(ComponentOfClass);
-				}
-			}
-		}
+			Result.Emplace(&Component);
+			return true;
+		});
 
 		return Result;
 	}
@@ -292,27 +418,19 @@ public:
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
 
-		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent<T>(Tags, MatchType, bExactMatch, [&Result](T& Component)
 		{
-			if (Component.IsValid())
-			{
-				if (T* ComponentOfClass = Cast<T>(Component))
-				{
-					Result.Emplace(ComponentOfClass);
-				}
-			}
-		}
+			Result.Emplace(&Component);
+			return true;
+		});
 
 		return Result;
 	}
@@ -322,27 +440,19 @@ public:
 	 * 
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTag& Tag, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to GetActors must be derived from AActor");
 
-		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachActor<T>(Tag, bExactMatch, [&Result](T& Actor)
 		{
-			if (Component.IsValid())
-			{
-				if (T* ActorOfClass = Cast<T>(Component->GetOwner()))
-				{
-					Result.Emplace(ActorOfClass);
-				}
-			}
-		}
+			Result.Emplace(&Actor);
+			return true;
+		});
 
 		return Result;
 	}
@@ -353,27 +463,19 @@ public:
 	 * @tparam T Only actors matching this class we'll be returned
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class T>
 	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to GetActors must be derived from AActor");
 
-		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 		TSet<TWeakObjectPtr<T>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachActor<T>(Tags, MatchType, bExactMatch, [&Result](T& Actor)
 		{
-			if (Component.IsValid())
-			{
-				if (T* ActorOfClass = Cast<T>(Component->GetOwner()))
-				{
-					Result.Emplace(ActorOfClass);
-				}
-			}
-		}
+			Result.Emplace(&Actor);
+			return true;
+		});
 
 		return Result;
 	}
@@ -384,7 +486,7 @@ public:
 	 * @tparam ActorT Only actors matching this class we'll be returned
 	 * @tparam ComponentT Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class ActorT, class ComponentT>
 	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTag& Tag, const bool bExactMatch = true) const
@@ -392,22 +494,15 @@ public:
 		static_assert(TPointerIsConvertibleFromTo<ActorT, const AActor>::Value, "'ActorT' template parameter to GetActorsAndComponents must be derived from AActor");
 		static_assert(TPointerIsConvertibleFromTo<ComponentT, const UActorComponent>::Value, "'ComponentT' template parameter to GetActorsAndComponents must be derived from UActorComponent");
 
-		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
-
 		TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent<ComponentT>(Tag, bExactMatch, [&Result](ComponentT& Component)
 		{
-			if (Component.IsValid())
+			if (ActorT* ActorOfClass = Cast<ActorT>(Component.GetOwner()))
 			{
-				ComponentT* ComponentOfClass = Cast<ComponentT>(Component);
-				ActorT* ActorOfClass = Cast<ActorT>(Component->GetOwner());
-				if (ComponentOfClass && ActorOfClass)
-				{
-					Result.Emplace(ActorOfClass, ComponentOfClass);
-				}
+				Result.Emplace(ActorOfClass, &Component);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
@@ -419,7 +514,7 @@ public:
 	 * @tparam ComponentT Only components matching this class we'll be returned
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
-	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching.
 	 */
 	template <class ActorT, class ComponentT>
 	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
@@ -427,27 +522,184 @@ public:
 		static_assert(TPointerIsConvertibleFromTo<ActorT, const AActor>::Value, "'ActorT' template parameter to GetActorsAndComponents must be derived from AActor");
 		static_assert(TPointerIsConvertibleFromTo<ComponentT, const UActorComponent>::Value, "'ComponentT' template parameter to GetActorsAndComponents must be derived from UActorComponent");
 
-		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
 		TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> Result;
-		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		ForEachComponent<ComponentT>(Tags, MatchType, bExactMatch, [&Result](ComponentT& Component)
 		{
-			if (Component.IsValid())
+			if (ActorT* ActorOfClass = Cast<ActorT>(Component.GetOwner()))
 			{
-				ComponentT* ComponentOfClass = Cast<ComponentT>(Component);
-				ActorT* ActorOfClass = Cast<ActorT>(Component->GetOwner());
-				if (ComponentOfClass && ActorOfClass)
-				{
-					Result.Emplace(ActorOfClass, ComponentOfClass);
-				}
+				Result.Emplace(ActorOfClass, &Component);
 			}
-		}
+			return true;
+		});
 
 		return Result;
 	}
 
+//////////////////////////////////////////////////////////////////////////
+// Allocation-free Component Queries
+// Each registered component is visited once, Visitor returns false to stop the iteration early.
+// Visitor must not register or unregister Flow Components, nor modify their Identity Tags.
+// If it might (i.e. it executes gameplay logic), gather components first with GatherComponents().
+
+	/**
+	 * Calls Visitor for every registered Flow Component of class T identified by given tag
+	 * 
+	 * @param Visitor Callable as bool(T&), returning false stops the iteration
+	 * @return False if the Visitor stopped the iteration
+	 */
+	template <class T, typename VisitorT>
+	bool ForEachComponent(const FGameplayTag& Tag, const bool bExactMatch, VisitorT&& Visitor) const
+	{
+		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to ForEachComponent must be derived from UActorComponent");
+
+		return VisitComponents(Tag, bExactMatch, [&Visitor](UFlowComponent& Component)
+		{
+			T* ComponentOfClass = Cast<T>(&Component);
+			return ComponentOfClass == nullptr || Invoke(Visitor, *ComponentOfClass);
+		});
+	}
+
+	/**
+	 * Calls Visitor for every registered Flow Component of class T identified by Any or All provided tags
+	 * 
+	 * @param Visitor Callable as bool(T&), returning false stops the iteration
+	 * @return False if the Visitor stopped the iteration
+	 */
+	template <class T, typename VisitorT>
+	bool ForEachComponent(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, VisitorT&& Visitor) const
+	{
+		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to ForEachComponent must be derived from UActorComponent");
+
+		return VisitComponents(Tags, MatchType, bExactMatch, [&Visitor](UFlowComponent& Component)
+		{
+			T* ComponentOfClass = Cast<T>(&Component);
+			return ComponentOfClass == nullptr || Invoke(Visitor, *ComponentOfClass);
+		});
+	}
+
+	/**
+	 * Calls Visitor for owner of class T of every registered Flow Component identified by given tag
+	 * 
+	 * @param Visitor Callable as bool(T&), returning false stops the iteration
+	 * @return False if the Visitor stopped the iteration
+	 */
+	template <class T, typename VisitorT>
+	bool ForEachActor(const FGameplayTag& Tag, const bool bExactMatch, VisitorT&& Visitor) const
+	{
+		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to ForEachActor must be derived from AActor");
+
+		return VisitComponents(Tag, bExactMatch, [&Visitor](UFlowComponent& Component)
+		{
+			T* ActorOfClass = Cast<T>(Component.GetOwner());
+			return ActorOfClass == nullptr || Invoke(Visitor, *ActorOfClass);
+		});
+	}
+
+	/**
+	 * Calls Visitor for owner of class T of every registered Flow Component identified by Any or All provided tags
+	 * 
+	 * @param Visitor Callable as bool(T&), returning false stops the iteration
+	 * @return False if the Visitor stopped the iteration
+	 */
+	template <class T, typename VisitorT>
+	bool ForEachActor(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, VisitorT&& Visitor) const
+	{
+		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to ForEachActor must be derived from AActor");
+
+		return VisitComponents(Tags, MatchType, bExactMatch, [&Visitor](UFlowComponent& Component)
+		{
+			T* ActorOfClass = Cast<T>(Component.GetOwner());
+			return ActorOfClass == nullptr || Invoke(Visitor, *ActorOfClass);
+		});
+	}
+
+	/* Returns first registered Flow Component of class T identified by given tag, stops iterating the registry as soon as it's found. */
+	template <class T>
+	T* FindComponent(const FGameplayTag& Tag, const bool bExactMatch = true) const
+	{
+		T* Result = nullptr;
+		ForEachComponent<T>(Tag, bExactMatch, [&Result](T& Component)
+		{
+			Result = &Component;
+			return false;
+		});
+
+		return Result;
+	}
+
+	/* Returns first registered Flow Component of class T identified by Any or All provided tags, stops iterating the registry as soon as it's found. */
+	template <class T>
+	T* FindComponent(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
+	{
+		T* Result = nullptr;
+		ForEachComponent<T>(Tags, MatchType, bExactMatch, [&Result](T& Component)
+		{
+			Result = &Component;
+			return false;
+		});
+
+		return Result;
+	}
+
+	/* Returns owner of class T of the first matching Flow Component identified by given tag, stops iterating the registry as soon as it's found. */
+	template <class T>
+	T* FindActor(const FGameplayTag& Tag, const bool bExactMatch = true) const
+	{
+		T* Result = nullptr;
+		ForEachActor<T>(Tag, bExactMatch, [&Result](T& Actor)
+		{
+			Result = &Actor;
+			return false;
+		});
+
+		return Result;
+	}
+
+	/* Returns owner of class T of the first matching Flow Component identified by Any or All provided tags, stops iterating the registry as soon as it's found. */
+	template <class T>
+	T* FindActor(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
+	{
+		T* Result = nullptr;
+		ForEachActor<T>(Tags, MatchType, bExactMatch, [&Result](T& Actor)
+		{
+			Result = &Actor;
+			return false;
+		});
+
+		return Result;
+	}
+
+	/**
+	 * Appends registered Flow Components identified by given tag to the caller-provided array, i.e. one using TInlineAllocator.
+	 * Use it instead of ForEachComponent if handling found components might modify the registry.
+	 */
+	template <class T, typename AllocatorT>
+	void GatherComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<T>, AllocatorT>& OutComponents) const
+	{
+		ForEachComponent<T>(Tag, bExactMatch, [&OutComponents](T& Component)
+		{
+			OutComponents.Emplace(&Component);
+			return true;
+		});
+	}
+
+	/**
+	 * Appends registered Flow Components identified by Any or All provided tags to the caller-provided array, i.e. one using TInlineAllocator.
+	 * Use it instead of ForEachComponent if handling found components might modify the registry.
+	 */
+	template <class T, typename AllocatorT>
+	void GatherComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TArray<TWeakObjectPtr<T>, AllocatorT>& OutComponents) const
+	{
+		ForEachComponent<T>(Tags, MatchType, bExactMatch, [&OutComponents](T& Component)
+		{
+			OutComponents.Emplace(&Component);
+			return true;
+		});
+	}
+
 private:
-	void FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
-	void FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
+	using FComponentVisitor = TFunctionRef<bool(UFlowComponent&)>;
+
+	bool VisitComponents(const FGameplayTag& Tag, const bool bExactMatch, FComponentVisitor Visitor) const;
+	bool VisitComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, FComponentVisitor Visitor) const;
 };
\ No newline at end of file
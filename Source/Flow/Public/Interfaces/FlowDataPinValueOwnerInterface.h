@@ -58,4 +58,22 @@ public:
 		const FName& PinName,
 		const FProperty*& OutFoundProperty,
 		TInstancedStruct<FFlowDataPinValue>& OutFoundInstancedStruct);
+
+	/* Non-copying version of TryFindPropertyByPinName, used when resolving a value straight into the caller storage (see FFlowDataPinValueSink).
+	* If returns true, either OutFoundProperty (on this object) or OutFoundValue is expected to carry the property value.
+	* Subclasses overriding TryFindPropertyByPinName should override this too, returning false falls back to TryFindPropertyByPinName. */
+	virtual bool TryFindPropertyViewByPinName(
+		const FName& PinName,
+		const FProperty*& OutFoundProperty,
+		const FFlowDataPinValue*& OutFoundValue) const;
+
+	static bool TryFindPropertyViewByPinName_Static(
+		const UObject& PropertyOwnerObject,
+		const FName& PinName,
+		const FProperty*& OutFoundProperty,
+		const FFlowDataPinValue*& OutFoundValue);
+
+	/* Equivalent of UClass::FindPropertyByName, looked up in the table of properties built once per class.
+	 * Table is rebuilt if the class layout changed, and dropped with the class. Game thread only. */
+	static const FProperty* FindPropertyByNameCached(const UClass& Class, const FName& PropertyName);
 };
@@ -26,4 +26,7 @@ public:
 	virtual TArray<FFlowNamedDataPinProperty>& GetMutableNamedProperties() = 0;
 	const TArray<FFlowNamedDataPinProperty>& GetNamedProperties() const 
 		{ return const_cast<IFlowNamedPropertiesSupplierInterface*>(this)->GetMutableNamedProperties(); }
+
+	/* Returns the first valid named property of given name. Default implementation scans the array, suppliers might index it. */
+	virtual const FFlowNamedDataPinProperty* FindNamedProperty(const FName& PropertyName) const;
 };
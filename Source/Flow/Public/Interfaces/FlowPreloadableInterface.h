@@ -42,7 +42,8 @@ public:
 	virtual EFlowPreloadResult K2_PreloadContent_Implementation() { return EFlowPreloadResult::Completed; }
 	virtual EFlowPreloadResult PreloadContent() { return Execute_K2_PreloadContent(Cast<UObject>(this)); }
 
-	/* Called by the preload helper to release this node's preloaded content. */
+	/* Called by the preload helper to release this node's preloaded content.
+	 * Also called while preload is still in progress, then pending loads should be cancelled and NotifyPreloadComplete() is ignored. */
 	UFUNCTION(BlueprintImplementableEvent, Category = FlowPreloadableInterface, DisplayName = "Flush Content")
 	void K2_FlushContent();
 	virtual void FlushContent() { Execute_K2_FlushContent(Cast<UObject>(this)); }
@@ -21,8 +21,10 @@ public:
 	UFlowNode_ComponentObserver();
 	
 	friend class FFlowNode_ComponentObserverDetails;
+	friend class UFlowSubsystem;
 
 protected:
+	/* Changes made while observing apply after observing starts again. */
 	UPROPERTY(EditAnywhere, Category = "ObservedComponent")
 	FGameplayTagContainer IdentityTags;
 
@@ -8,12 +8,32 @@
 
 #include "Interfaces/FlowPreloadableInterface.h"
 #include "Nodes/FlowNode.h"
+#include "Types/FlowEnumUtils.h"
 #include "FlowNode_PlayLevelSequence.generated.h"
 
 class UFlowLevelSequencePlayer;
 
 DECLARE_MULTICAST_DELEGATE(FFlowNodeLevelSequenceEvent);
 
+/* What happens on Start, if the sequence hasn't been preloaded. */
+UENUM()
+enum class EFlowSequenceLoadingMode : uint8
+{
+	/* Load the sequence synchronously and start playback immediately. */
+	LoadSynchronously,
+
+	/* Stream the sequence and its dependencies asynchronously, playback starts once it's loaded. */
+	DelayStart,
+
+	/* Don't play the sequence, trigger Out and Completed as if playback finished immediately. */
+	Skip,
+
+	Max UMETA(Hidden),
+	Invalid UMETA(Hidden),
+	Min = 0 UMETA(Hidden),
+};
+FLOW_ENUM_RANGE_VALUES(EFlowSequenceLoadingMode)
+
 /**
  * Order of triggering outputs after calling Start
  * - PreStart, just before starting playback
@@ -40,6 +60,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Sequence")
 	TSoftObjectPtr<ULevelSequence> Sequence;
 
+	/* Used on Start if the sequence isn't loaded yet, i.e. it hasn't been preloaded. */
+	UPROPERTY(EditAnywhere, Category = "Sequence")
+	EFlowSequenceLoadingMode LoadingMode;
+
 	UPROPERTY(EditAnywhere, Category = "Sequence")
 	FMovieSceneSequencePlaybackSettings PlaybackSettings;
 
@@ -90,6 +114,21 @@ protected:
 	FStreamableManager StreamableManager;
 
 	TSharedPtr<FStreamableHandle> PreloadHandle;
+	double PreloadRequestTime;
+
+	/* Start is waiting for the sequence to stream in. Saved, so loading the SaveGame restarts the load. */
+	UPROPERTY(SaveGame)
+	bool bWaitingForSequenceLoad;
+
+	/* Pause has been triggered while waiting for the sequence, and not resumed since. Playback is paused as soon as it starts. */
+	UPROPERTY(SaveGame)
+	bool bPauseWhenStarted;
+
+	TSharedPtr<FStreamableHandle> SequenceLoadHandle;
+	double SequenceLoadRequestTime;
+
+	/* Seconds between requesting the sequence and having it loaded, measured by the last preload or delayed start. Negative if nothing has been streamed yet. */
+	float LastLoadLatency;
 
 public:
 #if WITH_EDITOR
@@ -112,6 +151,12 @@ public:
 protected:
 	virtual void ExecuteInput(const FName& PinName) override;
 
+	void StartPlayback();
+	void RequestSequenceLoad();
+	void OnSequenceLoaded();
+	void CancelSequenceLoad();
+	void ReportLoadLatency(const double RequestTime, const TCHAR* Context);
+
 	virtual void OnSave_Implementation() override;
 	virtual void OnLoad_Implementation() override;
 
@@ -134,6 +179,9 @@ protected:
 public:
 	FString GetPlaybackProgress() const;
 
+	bool IsWaitingForSequenceLoad() const { return bWaitingForSequenceLoad; }
+	float GetLastLoadLatency() const { return LastLoadLatency; }
+
 #if WITH_EDITOR
 	virtual FString GetNodeDescription() const override;
 	virtual EDataValidationResult ValidateNode() override;
@@ -17,7 +17,9 @@
 #include "FlowNode.generated.h"
 
 struct FFlowNodeSaveData;
+struct FFlowSaveNameTable;
 struct FFlowPreloadHelper;
+struct FStreamableHandle;
 
 /**
  * A Flow Node is UObject-based node designed to handle entire gameplay feature within single node.
@@ -38,6 +40,8 @@ public:
 	friend class UFlowNodeAddOn;
 	friend class SFlowInputPinHandle;
 	friend class SFlowOutputPinHandle;
+	friend struct FFlowExecutionPlan;
+	friend struct FFlowPreloadLookahead;
 
 //////////////////////////////////////////////////////////////////////////
 // Node
@@ -78,6 +82,7 @@ public:
 #if WITH_EDITOR
 	// UObject	
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
 	// --
 #endif
 
@@ -85,6 +90,24 @@ public:
 	UPROPERTY()
 	FGuid NodeGuid;
 
+protected:
+	/* Index of this node in the execution plan of the owning asset instance, assigned by UFlowAsset::InitializeInstance. */
+	int32 PlanNodeIndex = INDEX_NONE;
+
+	/* Index of this node in UFlowAsset::ActiveNodes, INDEX_NONE if node isn't active. Maintained by the owning asset. */
+	int32 ActiveNodeIndex = INDEX_NONE;
+
+	/* Whether the owning asset has this node in its RecordedNodes. Cleared by ResetRecords(). */
+	bool bRecordedByAsset = false;
+
+	/* Template node this instance has been created from, nullptr for the template itself.
+	 * Node instances don't keep their own copy of Connections and MapDataPinNameToPropertySource, they read them from the template. */
+	UPROPERTY(Transient)
+	TObjectPtr<UFlowNode> TemplateNode;
+
+	/* Returns node holding data shared by all instances of the template node. */
+	const UFlowNode& GetSharedDataNode() const { return TemplateNode ? *TemplateNode : *this; }
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "FlowNode")
 	void SetGuid(const FGuid& NewGuid) { NodeGuid = NewGuid; }
@@ -184,8 +207,9 @@ protected:
 //////////////////////////////////////////////////////////////////////////
 // Connections to other nodes
 
-protected:
-	/* Map input/outputs to the connected node and input pin. */
+private:
+	/* Map input/outputs to the connected node and input pin.
+	 * Empty on node instances, read it via GetConnections(). */
 	UPROPERTY()
 	TMap<FName, FConnectedPin> Connections;
 
@@ -194,7 +218,9 @@ public:
 	void SetConnections(const TMap<FName, FConnectedPin>& InConnections);
 #endif
 
-	FConnectedPin GetConnection(const FName OutputName) const { return Connections.FindRef(OutputName); }
+	/* Returns connections of the template node, shared by all its instances. */
+	const TMap<FName, FConnectedPin>& GetConnections() const { return GetSharedDataNode().Connections; }
+	FConnectedPin GetConnection(const FName OutputName) const { return GetConnections().FindRef(OutputName); }
 
 	UFUNCTION(BlueprintPure, Category= "FlowNode")
 	TSet<UFlowNode*> GatherConnectedNodes() const;
@@ -234,8 +260,9 @@ public:
 	static void RecursiveFindNodesByClass(UFlowNode* Node, const TSubclassOf<UFlowNode> Class, uint8 Depth, TArray<UFlowNode*>& OutNodes);
 
 protected:
-	/* Slow and fast lookup functions, based on whether we are proactively caching the connections for quick lookup
-	 * in the Connections array (by PinCategory). */
+	/* Lookup functions, based on whether we are proactively caching the connections for quick lookup
+	 * in the Connections array (by PinCategory). Uncached lookup uses the reverse index built by the asset's execution plan,
+	 * returning pins on the other end of connections. */
 	bool FindConnectedNodeForPinCached(const FName& FlowPinName, FConnectedPin& ConnectedPin) const;
 	bool FindConnectedNodeForPinUncached(const FName& FlowPinName, TArray<FConnectedPin>* ConnectedPins = nullptr) const;
 
@@ -268,9 +295,13 @@ protected:
 public:
 	using TFlowPinValueSupplierDataArray = FlowArray::TInlineArray<FFlowPinValueSupplierData, 4>;
 
+	/* Returns data pin property sources of the template node, shared by all its instances. */
+	const TMap<FName, FFlowPinPropertySource>& GetDataPinPropertySources() const { return GetSharedDataNode().MapDataPinNameToPropertySource; }
+
+private:
 	/* Map for PinName to Property supplier for non-trivial data pin property lookups.
 	 * Non-trivial means a different pin name from its property source, or a non-zero property owner object index.
-	 * See TryGatherPropertyOwnersAndPopulateResult(). */
+	 * See TryGatherPropertyOwnersAndPopulateResult(). Empty on node instances, read it via GetDataPinPropertySources(). */
 	UPROPERTY()
 	TMap<FName, FFlowPinPropertySource> MapDataPinNameToPropertySource;
 
@@ -310,6 +341,43 @@ public:
 
 	bool TryGetFlowDataPinSupplierDatasForPinName(const FName& PinName, TFlowPinValueSupplierDataArray& InOutPinValueSupplierDatas) const;
 
+protected:
+	/* Helper for TryGatherPropertyOwnersAndPopulateResult(), writes the value straight to FFlowDataPinValueSink if one is pending for this pin. */
+	bool TrySupplyPendingValueSink(const UObject& PropertyOwnerObject, const FName& PinName, const FFlowPinType& DataPinType, const FName& PropertyName, FFlowDataPinResult& OutSuppliedResult) const;
+
+	/* Native class which TrySupplyDataPin() doesn't inspect the result of UFlowNode::TrySupplyDataPin(), set in its constructor.
+	 * Pending FFlowDataPinValueSink is supplied only by nodes of this exact native class, as native subclasses might override TrySupplyDataPin()
+	 * and read the ResultValue, which isn't set while supplying the sink. */
+	const UClass* ValueSinkNativeClass = nullptr;
+
+	/* If enabled, input is executed only once soft references supplied to input data pins are loaded, i.e. unloaded Object or Class values.
+	 * Assets are streamed in asynchronously, instead of being loaded synchronously while resolving data pins during node execution. */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay, Category = "FlowNode")
+	bool bDeferInputUntilDataPinsLoaded = false;
+
+	/* Returns true if the input has been deferred, since its input data pins are waiting for assets to stream in. */
+	bool TryDeferInputUntilDataPinsLoaded(const FName& PinName);
+
+	/* Input data pins read while executing the given input, resolved ahead of execution to find unloaded assets.
+	 * By default, all connected input data pins. Override it to skip pins the given input doesn't read. */
+	virtual void GetDataPinsReadByInput(const FName& InputPinName, TArray<FName>& OutDataPinNames) const;
+
+	/* Resolves input data pins read by the given input, only to collect soft references of unloaded assets. */
+	TArray<FSoftObjectPath> GatherUnloadedDataPinPaths(const FName& InputPinName) const;
+	void RequestDeferredDataPinsLoad(const TArray<FSoftObjectPath>& PathsToLoad);
+	void OnDeferredDataPinsLoaded();
+	void CancelDeferredDataPinsLoad();
+
+	/* Requests assets again for inputs deferred at the moment of saving the game. */
+	void RestoreDeferredInputs();
+
+private:
+	/* Inputs triggered while data pin assets were streaming in, executed in order once the load completes.
+	 * Saved, so loading the SaveGame restarts the load. */
+	UPROPERTY(SaveGame)
+	TArray<FName> DeferredInputPinNames;
+	TSharedPtr<FStreamableHandle> DeferredDataPinsLoadHandle;
+
 	// #FlowDataPinLegacy
 public:
 	void FixupDataPinTypes();
@@ -348,7 +416,19 @@ public:
 	virtual void ExecuteInput(const FName& PinName) override;
 	// --
 
+	/* True if the instance pool can reuse this node instance, see FFlowInstancePoolSettings. Nodes with AddOns are always created again. */
+	bool CanBeReusedByInstancePool() const;
+
 protected:
+	/* Enable if node restores all its runtime properties in Cleanup() or DeinitializeInstance(), so the instance pool can reuse its instance.
+	 * Otherwise recycled Flow Asset instance gets a new instance of this node, created from the template node. */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay, Category = "FlowNode")
+	bool bSupportsInstancePooling = false;
+
+	/* Built-in node supports instance pooling without bSupportsInstancePooling, if set to its own class in the constructor.
+	 * Doesn't apply to subclasses, as these might add runtime properties. */
+	const UClass* InstancePoolingClass = nullptr;
+
 	UPROPERTY(SaveGame)
 	EFlowNodeState ActivationState;
 
@@ -418,6 +498,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FlowNode")
 	void LoadInstance(const FFlowNodeSaveData& NodeRecord);
 
+	/* Forces node to be serialized again on the next save. Needed only with save data caching enabled,
+	 * if SaveGame properties change outside of executing input or triggering output, i.e. in a delegate callback. */
+	UFUNCTION(BlueprintCallable, Category = "FlowNode")
+	void MarkSaveDirty();
+
+	/* True if the next save can reuse node data written by the previous save, with the same name table. */
+	bool CanReuseSaveData(const FFlowSaveNameTable* NameTable) const;
+
+protected:
+	/* If enabled, node is serialized only if its state changed since the previous save, otherwise saved data is reused.
+	 * Node is marked dirty automatically on executing input, triggering output, finishing and loading.
+	 * Keep disabled if SaveGame properties are gathered in OnSave(), i.e. the remaining time of a timer. */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay, Category = "FlowNode")
+	bool bCacheSaveData = false;
+
+	/* Built-in node caches its save data without bCacheSaveData, if set to its own class in the constructor.
+	 * Doesn't apply to subclasses, as these might save additional properties or override OnSave(). */
+	const UClass* SaveDataCacheClass = nullptr;
+
+	bool IsSaveDataCacheEnabled() const { return bCacheSaveData || (SaveDataCacheClass && GetClass() == SaveDataCacheClass); }
+
+private:
+	bool bSaveDirty = true;
+
+	/* NodeData written by the previous save, kept only with save data caching enabled. */
+	TArray<uint8> CachedSaveData;
+	FGuid CachedSaveFormatId;
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "FlowNode")
 	void OnSave();
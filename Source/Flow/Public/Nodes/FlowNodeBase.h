@@ -287,6 +287,9 @@ protected:
 private:
 	UFUNCTION(BlueprintPure, Category = DataPins, DisplayName = "Resolve DataPin By Name")
 	FFlowDataPinResult TryResolveDataPin(FName PinName) const;
+
+	/* TryResolveDataPin, letting the suppliers write the value straight into the given sink (optional). */
+	FFlowDataPinResult TryResolveDataPinWithValueSink(const FName& PinName, FFlowDataPinValueSink* ValueSink) const;
 	
 public:
 	/* Generic single-value resolve & extractor. */
@@ -571,6 +574,22 @@ protected:
 template <typename TFlowPinType>
 EFlowDataPinResolveResult UFlowNodeBase::TryResolveDataPinValue(const FName& PinName, typename TFlowPinType::ValueType& OutValue, EFlowSingleFromArray SingleFromArray /*= EFlowSingleFromArray::LastValue*/) const
 {
+	if constexpr (FlowPinType::CFlowPinTypeWithValueSink<TFlowPinType>)
+	{
+		if (IsInGameThread())
+		{
+			// Standard suppliers write straight into OutValue, skipping the FFlowDataPinResult::ResultValue allocation
+			FFlowDataPinValueSink ValueSink = FlowPinType::MakeValueSink<TFlowPinType>(OutValue, SingleFromArray);
+			const FFlowDataPinResult DataPinResult = TryResolveDataPinWithValueSink(PinName, &ValueSink);
+			if (ValueSink.WasSupplied())
+			{
+				return ValueSink.GetResult();
+			}
+
+			return FlowPinType::TryExtractValue<TFlowPinType>(DataPinResult, OutValue, SingleFromArray);
+		}
+	}
+
 	const FFlowDataPinResult DataPinResult = TryResolveDataPin(PinName);
 	return FlowPinType::TryExtractValue<TFlowPinType>(DataPinResult, OutValue, SingleFromArray);
 }
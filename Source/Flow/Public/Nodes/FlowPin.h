@@ -354,6 +354,9 @@ struct FLOW_API FPinRecord
 	static FString ForcedActivation;
 	static FString PassThroughActivation;
 
+	/* Only the most recent activations are kept, so looping graphs don't grow records indefinitely. */
+	static constexpr int32 MaxRecordsPerPin = 64;
+
 	FPinRecord();
 	FPinRecord(const double InTime, const EFlowPinActivationType InActivationType);
 
@@ -26,9 +26,17 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Configuration", DisplayName = Properties)
 	TArray<FFlowNamedDataPinProperty> NamedProperties;
 
+	/* Index of the first valid named property per name, built for runtime instances, as properties don't change after instantiation. */
+	TMap<FName, int32> NamedPropertyIndices;
+
 public:
 	virtual void PostLoad() override;
 
+	// IFlowCoreExecutableInterface
+	virtual void InitializeInstance() override;
+	virtual void DeinitializeInstance() override;
+	// --
+
 #if WITH_EDITOR
 	// IFlowContextPinSupplierInterface
 	virtual bool SupportsContextPins() const override;
@@ -41,6 +49,7 @@ public:
 
 	// IFlowNamedPropertiesSupplierInterface
 	virtual TArray<FFlowNamedDataPinProperty>& GetMutableNamedProperties() override { return NamedProperties; }
+	virtual const FFlowNamedDataPinProperty* FindNamedProperty(const FName& PropertyName) const override;
 	// --
 
 	bool TryFormatTextWithNamedPropertiesAsParameters(const FText& FormatText, FText& OutFormattedText) const;
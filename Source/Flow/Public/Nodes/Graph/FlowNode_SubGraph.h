@@ -6,6 +6,7 @@
 #include "FlowNode_SubGraph.generated.h"
 
 class UFlowAssetParams;
+struct FStreamableHandle;
 
 /**
  * Creates instance of provided Flow Asset and starts its execution.
@@ -40,12 +41,34 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Graph")
 	bool bCanInstanceIdenticalAsset;
 
+	/* If enabled, Flow Asset that isn't loaded yet is streamed in asynchronously, instead of being loaded synchronously on activation.
+	 * Node stays active and buffers its inputs until the subgraph instance is created. Preloading completes once the asset is loaded. */
+	UPROPERTY(EditAnywhere, Category = "Graph")
+	bool bLoadAssetAsynchronously;
+
 	UPROPERTY(SaveGame)
 	FString SavedAssetInstanceName;
 
+	/* Inputs received while the asset is streaming in. Saved, so loading the SaveGame restarts the load. */
+	UPROPERTY(SaveGame)
+	TArray<FName> BufferedInputNames;
+
+	TSharedPtr<FStreamableHandle> AssetLoadHandle;
+	bool bPreloadingAsset = false;
+
+	/* Set once the streaming request completes, even if it failed. Inputs replayed afterwards don't request the same paths again. */
+	bool bAsyncLoadCompleted = false;
+
 protected:
 	virtual bool CanBeAssetInstanced() const;
 
+	bool IsLoadingAsset() const { return AssetLoadHandle.IsValid(); }
+
+	/* Returns true if the asset is being streamed in, otherwise the asset is already loaded or has to be loaded synchronously. */
+	bool TryLoadAssetAsync();
+	void OnAssetLoaded();
+	void CancelAssetLoad();
+
 	// IFlowPreloadableInterface
 	virtual EFlowPreloadResult PreloadContent() override;
 	virtual void FlushContent() override;
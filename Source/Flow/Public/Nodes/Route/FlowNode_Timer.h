@@ -1,12 +1,13 @@
 // Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
 #pragma once
 
-#include "Engine/EngineTypes.h"
 #include "Nodes/FlowNode.h"
+#include "Types/FlowTimerWheel.h"
 #include "FlowNode_Timer.generated.h"
 
 /**
  * Triggers outputs after time elapsed.
+ * Driven by the Flow Subsystem timer wheel instead of the world Timer Manager.
  */
 UCLASS(NotBlueprintable, meta = (DisplayName = "Timer", Keywords = "delay, step, tick"))
 class FLOW_API UFlowNode_Timer : public UFlowNode
@@ -28,8 +29,8 @@ protected:
 	static FName INPIN_CompletionTime;
 
 private:
-	FTimerHandle CompletionTimerHandle;
-	FTimerHandle StepTimerHandle;
+	FFlowTimerHandle CompletionTimerHandle;
+	FFlowTimerHandle StepTimerHandle;
 
 	UPROPERTY(SaveGame)
 	float ResolvedCompletionTime;
@@ -51,6 +52,7 @@ protected:
 	virtual void Restart();
 
 	float ResolveCompletionTime() const;
+	FFlowTimerWheel* GetTimerWheel() const;
 	
 private:
 	UFUNCTION()
@@ -83,7 +83,7 @@ protected:
 
 	/* Number of outstanding async completions (node + addons) between TriggerPreload and full completion.
 	 * Counts up before any PreloadContent calls so re-entrant NotifyPreloadComplete() is safe.
-	 * TriggerFlush resets to 0; OnPreloadComplete decrements; AllPreloadsComplete fires when it reaches 0. */
+	 * TriggerFlush resets to 0 and cancels preload in progress; OnPreloadComplete decrements; AllPreloadsComplete fires when it reaches 0. */
 	int32 PendingPreloadCount = 0;
 
 public:	
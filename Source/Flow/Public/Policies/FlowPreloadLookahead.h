@@ -0,0 +1,54 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+#pragma once
+
+#include "Containers/Array.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UFlowAsset;
+class UFlowNode;
+struct FFlowExecutionPlan;
+struct FFlowPreloadPolicy;
+
+/**
+ * Drives lookahead preloading for a single Flow Asset instance.
+ * Nodes using EFlowPreloadTiming::WithinLookahead are preloaded once any active node is within their lookahead distance,
+ * measured in exec transitions of the ExecutionPlan. Nodes using EFlowFlushTiming::OnLeavingLookahead are flushed once no active node is that close.
+ * Distances are found by a breadth-first search bounded by the largest lookahead distance, run whenever the set of active nodes changes.
+ * Instances without such nodes don't track anything and pay nothing.
+ */
+struct FLOW_API FFlowPreloadLookahead
+{
+public:
+	void Initialize(const UFlowAsset& FlowAsset, const FFlowPreloadPolicy& Policy);
+	void Reset();
+
+	bool IsEnabled() const { return !TrackedNodes.IsEmpty(); }
+
+	/* Preloads nodes which got into the range of active nodes, and flushes nodes which left it.
+	 * Safe to call re-entrantly, i.e. from preload completion triggering other nodes. Nested call is folded into another pass. */
+	void Update(const UFlowAsset& FlowAsset);
+
+private:
+	struct FTrackedNode
+	{
+		TWeakObjectPtr<UFlowNode> Node;
+		int32 NodeIndex = INDEX_NONE;
+		int32 LookaheadDistance = 0;
+		bool bPreloadWhenEntering = false;
+		bool bFlushWhenLeaving = false;
+		bool bInRange = false;
+	};
+
+	TArray<FTrackedNode> TrackedNodes;
+	int32 MaxLookaheadDistance = 0;
+
+	/* Distance from the closest active node per plan node, INDEX_NONE if not reached. Only visited entries are reset after the search. */
+	TArray<int32> Distances;
+	TArray<int32> SearchQueue;
+
+	bool bIsUpdating = false;
+	bool bUpdateRequested = false;
+
+	void FindDistances(const FFlowExecutionPlan& Plan, const UFlowAsset& FlowAsset);
+	void ApplyRanges();
+};
@@ -24,6 +24,10 @@ struct FLOW_API FFlowPreloadPolicy : public FFlowPolicy
 	 * Override in subclasses for code-driven per-node logic. */
 	virtual EFlowFlushTiming GetFlushTimingForNode(const UFlowNode& Node) const PURE_VIRTUAL(FFlowPreloadPolicy::GetFlushTimingForNode, return EFlowFlushTiming::Invalid;);
 
+	/* Returns how many exec transitions ahead of active nodes the given node gets preloaded, used with EFlowPreloadTiming::WithinLookahead.
+	 * Not pure virtual, so policies written before lookahead support keep compiling. */
+	virtual int32 GetLookaheadDistanceForNode(const UFlowNode& Node) const { return 1; }
+
 	/* Returns the UScriptStruct type to instantiate as the FFlowPreloadHelper for a given preloadable node.
 	 * Default returns FFlowPreloadHelper_Standard. Override to supply project-specific helper types. */
 	virtual UScriptStruct* GetPreloadHelperStructType(const UFlowNode& Node) const PURE_VIRTUAL(FFlowPreloadPolicy::GetPreloadHelperStructType, return nullptr;);
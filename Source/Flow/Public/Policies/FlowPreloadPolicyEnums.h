@@ -19,6 +19,10 @@ enum class EFlowPreloadTiming : uint8
 	/* Do not automatically preload; content is ONLY preloaded when the Preload exec pin is triggered. */
 	ManualOnly,
 
+	/* Preload content when the node gets within the lookahead distance (number of exec transitions) of any active node.
+	 * Node still preloads on activation, if it was reached in another way, i.e. by a Custom Input. */
+	WithinLookahead,
+
 	Max     UMETA(Hidden),
 	Invalid UMETA(Hidden),
 	Min = 0 UMETA(Hidden),
@@ -40,6 +44,9 @@ enum class EFlowFlushTiming : uint8
 	/* Do not automatically flush; content is ONLY flushed when the Flush exec pin is triggered. */
 	ManualOnly,
 
+	/* Flush content when no active node is within the lookahead distance of this node anymore. */
+	OnLeavingLookahead,
+
 	Max     UMETA(Hidden),
 	Invalid UMETA(Hidden),
 	Min = 0 UMETA(Hidden),
@@ -27,6 +27,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Preload")
 	TMap<FName, EFlowFlushTiming> NodeFlushTimingOverrides;
 
+	/* Default number of exec transitions from active nodes, within which nodes using WithinLookahead timing are preloaded. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Preload", meta = (ClampMin = 0))
+	int32 DefaultLookaheadDistance = 2;
+
+	/* Per-node-class lookahead distance overrides (key = GetFName(), e.g. "FlowNode_SubGraph"). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Preload")
+	TMap<FName, int32> NodeLookaheadDistanceOverrides;
+
 public:
 	/* Returns the resolved preload timing for the given node, checking per-class overrides first.
 	 * Override in subclasses for code-driven per-node logic. */
@@ -36,6 +44,9 @@ public:
 	 * Override in subclasses for code-driven per-node logic. */
 	virtual EFlowFlushTiming GetFlushTimingForNode(const UFlowNode& Node) const override;
 
+	/* Returns the lookahead distance for the given node, checking per-class overrides first. */
+	virtual int32 GetLookaheadDistanceForNode(const UFlowNode& Node) const override;
+
 	/* Returns the UScriptStruct type to instantiate as the FFlowPreloadHelper for a given preloadable node.
 	 * Default returns FFlowPreloadHelper_Standard. Override to supply project-specific helper types. */
 	virtual UScriptStruct* GetPreloadHelperStructType(const UFlowNode& Node) const override;
@@ -0,0 +1,81 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+#pragma once
+
+#include "UObject/ObjectKey.h"
+#include "Types/FlowDataPinResults.h"
+
+#include "FlowDataPinResolveCache.generated.h"
+
+USTRUCT(BlueprintType)
+struct FLOW_API FFlowDataPinResolveCacheStats
+{
+	GENERATED_BODY()
+
+	/* Data pin values reused from the cache, instead of asking the supplier again. */
+	UPROPERTY(BlueprintReadOnly, Category = DataPins)
+	int32 NumHits = 0;
+
+	/* Data pin values supplied while the cache was active, and stored in it. */
+	UPROPERTY(BlueprintReadOnly, Category = DataPins)
+	int32 NumMisses = 0;
+
+	/* Times the cache was flushed, since some node triggered an output. */
+	UPROPERTY(BlueprintReadOnly, Category = DataPins)
+	int32 NumInvalidations = 0;
+};
+
+/**
+ * Opt-in memoization of data pin values for a single node activation or evaluation, i.e. evaluating all predicate AddOns of the Branch node.
+ * While the scope is alive, the value supplied by a given supplier pin is reused by every data pin connected to it.
+ * Cache is suspended while any node triggers an output, so downstream nodes don't read memoized values, and flushed afterwards,
+ * as the execution of downstream nodes might change the supplied values.
+ * Scopes can be nested, the outermost one owns the cache. Game thread only, scopes opened on other threads do nothing.
+ */
+class FLOW_API FFlowDataPinResolveCacheScope
+{
+public:
+	/* Scope does nothing if not enabled, so callers can decide at runtime whether to cache values. */
+	explicit FFlowDataPinResolveCacheScope(const bool bEnabled = true);
+	~FFlowDataPinResolveCacheScope();
+
+	FFlowDataPinResolveCacheScope(const FFlowDataPinResolveCacheScope&) = delete;
+	FFlowDataPinResolveCacheScope& operator=(const FFlowDataPinResolveCacheScope&) = delete;
+
+	static bool IsActive() { return Active != nullptr; }
+
+	/* Returns the result cached for the supplier pin, if the scope is active. */
+	static const FFlowDataPinResult* FindResult(const UObject& Supplier, const FName& SupplierPinName);
+	static void AddResult(const UObject& Supplier, const FName& SupplierPinName, const FFlowDataPinResult& Result);
+
+	/* Flushes the cache of the active scope. */
+	static void Invalidate();
+
+	static const FFlowDataPinResolveCacheStats& GetStats() { return Stats; }
+	static void ResetStats() { Stats = FFlowDataPinResolveCacheStats(); }
+
+private:
+	TMap<TPair<FObjectKey, FName>, FFlowDataPinResult> CachedResults;
+	bool bOwnsCache = false;
+
+	static FFlowDataPinResolveCacheScope* Active;
+	static FFlowDataPinResolveCacheStats Stats;
+
+	friend class FFlowDataPinResolveCacheSuspendScope;
+};
+
+/**
+ * Hides the active cache from code executed within the scope, i.e. downstream nodes executed by triggering an output.
+ * Cache is flushed once it's restored. Game thread only.
+ */
+class FLOW_API FFlowDataPinResolveCacheSuspendScope
+{
+public:
+	FFlowDataPinResolveCacheSuspendScope();
+	~FFlowDataPinResolveCacheSuspendScope();
+
+	FFlowDataPinResolveCacheSuspendScope(const FFlowDataPinResolveCacheSuspendScope&) = delete;
+	FFlowDataPinResolveCacheSuspendScope& operator=(const FFlowDataPinResolveCacheSuspendScope&) = delete;
+
+private:
+	FFlowDataPinResolveCacheScope* SuspendedScope = nullptr;
+};
@@ -7,6 +7,7 @@
 #include "Types/FlowPinEnums.h"
 #include "FlowDataPinResults.generated.h"
 
+class FProperty;
 struct FInstancedStruct;
 struct FFlowDataPinValue;
 
@@ -37,6 +38,73 @@ public:
 	TInstancedStruct<FFlowDataPinValue> ResultValue;
 };
 
+/**
+ * Caller-provided storage for resolving a single value of a standard pin type, see UFlowNodeBase::TryResolveDataPinValue.
+ * While pending, UFlowNode supplying the matching pin writes the value straight into the storage
+ * and returns the FFlowDataPinResult without the ResultValue, so no value struct is allocated on the way.
+ * Owners supplying values in a different way (i.e. overriding TrySupplyDataPin) keep returning the ResultValue as usual,
+ * see UFlowNode::ValueSinkNativeClass.
+ */
+struct FLOW_API FFlowDataPinValueSink
+{
+	using FExtractFromPropertyFunc = EFlowDataPinResolveResult (*)(const FProperty* Property, const void* Container, EFlowSingleFromArray SingleFromArray, void* OutValue);
+	using FExtractFromValueFunc = EFlowDataPinResolveResult (*)(const FFlowDataPinValue& Value, EFlowSingleFromArray SingleFromArray, void* OutValue);
+
+	FFlowDataPinValueSink(const FName& InPinTypeName, const EFlowSingleFromArray InSingleFromArray, FExtractFromPropertyFunc InExtractFromProperty, FExtractFromValueFunc InExtractFromValue, void* InOutValue)
+		: PinTypeName(InPinTypeName)
+		, SingleFromArray(InSingleFromArray)
+		, ExtractFromPropertyFunc(InExtractFromProperty)
+		, ExtractFromValueFunc(InExtractFromValue)
+		, OutValue(InOutValue)
+	{
+	}
+
+	/* Returns the pending sink, if it's waiting for the given pin of the given supplier. Game thread only. */
+	static FFlowDataPinValueSink* FindPending(const UObject& InSupplier, const FName& PinName, const FName& InPinTypeName);
+
+	/* Prepares the sink for asking the next supplier. */
+	void Reset(const UObject* InSupplier, const FName& InSupplierPinName);
+
+	/* Extracts the value of owner's property into the caller storage.
+	 * Returns false if the value can't be viewed in place or doesn't match the pin type, so it has to be supplied the usual way. */
+	bool TrySupplyFromOwner(const UObject& PropertyOwnerObject, const FName& PropertyName);
+
+	bool WasSupplied() const { return bSupplied; }
+	EFlowDataPinResolveResult GetResult() const { return Result; }
+
+	/* Sets the pending sink for the scope (nullptr suspends the pending one), only on the game thread. */
+	struct FScopedPending
+	{
+		explicit FScopedPending(FFlowDataPinValueSink* InSink);
+		~FScopedPending();
+
+	private:
+		FFlowDataPinValueSink* PreviousSink = nullptr;
+		bool bIsActive = false;
+	};
+
+private:
+	/* Sink waiting for the value, set for the duration of a single TrySupplyDataPin call. Use FindPending() and FScopedPending. */
+	static FFlowDataPinValueSink* Pending;
+
+	FName PinTypeName;
+	EFlowSingleFromArray SingleFromArray;
+
+	/* Supplier and its pin currently asked for the value. */
+	const UObject* Supplier = nullptr;
+	FName SupplierPinName;
+
+	FExtractFromPropertyFunc ExtractFromPropertyFunc = nullptr;
+	FExtractFromValueFunc ExtractFromValueFunc = nullptr;
+	void* OutValue = nullptr;
+
+	EFlowDataPinResolveResult Result = EFlowDataPinResolveResult::FailedUnimplemented;
+	bool bSupplied = false;
+
+	bool TrySupplyFromProperty(const FProperty* Property, const void* Container);
+	bool TrySupplyFromValue(const FFlowDataPinValue& Value);
+};
+
 // #FlowDataPinLegacy
 
 USTRUCT(BlueprintType, DisplayName = "Flow DataPin Result (Bool)", meta = (DeprecatedClass))
@@ -3,6 +3,7 @@
 
 #include "Types/FlowDataPinValue.h"
 #include "Types/FlowPinTypesStandard.h"
+#include "Types/FlowSoftReferenceLoading.h"
 
 #include "StructUtils/InstancedStruct.h"
 #include "GameplayTagContainer.h"
@@ -264,7 +265,7 @@ public:
 			return EFlowDataPinResolveResult::FailedInsufficientValues;
 		}
 
-		UEnum* EnumClassPtr = EnumClass.LoadSynchronous();
+		UEnum* EnumClassPtr = Cast<UEnum>(FlowSoftReference::LoadOrDefer(EnumClass.ToSoftObjectPath()));
 		if (!TryGetEnumValueByName(EnumClassPtr, Values[Index], OutEnumValue, GetByNameFlags))
 		{
 			return EFlowDataPinResolveResult::FailedUnknownEnumValue;
@@ -280,7 +281,7 @@ public:
 			return EFlowDataPinResolveResult::FailedInsufficientValues;
 		}
 
-		UEnum* EnumClassPtr = EnumClass.LoadSynchronous();
+		UEnum* EnumClassPtr = Cast<UEnum>(FlowSoftReference::LoadOrDefer(EnumClass.ToSoftObjectPath()));
 		OutEnumValues.Reserve(Values.Num());
 
 		for (const ValueType& ValueName : Values)
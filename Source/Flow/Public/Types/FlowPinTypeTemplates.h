@@ -12,6 +12,7 @@
 #include "UObject/UnrealType.h"
 #include "Types/FlowDataPinValuesStandard.h"
 #include "Types/FlowDataPinResults.h"
+#include "Types/FlowSoftReferenceLoading.h"
 #include "FlowLogChannels.h"
 #include <limits>
 #include <type_traits>
@@ -189,6 +190,23 @@ namespace FlowPinType
 		return EFlowDataPinResolveResult::Success;
 	}
 
+	/* Picks a single value out of Num values per the policy (EntireArray picks the first one) and passes its index to the Getter. */
+	template <typename TGetter>
+	FORCEINLINE EFlowDataPinResolveResult PickSingleValue(const int32 Num, EFlowSingleFromArray Policy, TGetter&& Getter)
+	{
+		const int32 Index = Policy == EFlowSingleFromArray::EntireArray
+			? (Num > 0 ? 0 : INDEX_NONE)
+			: EFlowSingleFromArray_Classifiers::ConvertToIndex(Policy, Num);
+
+		if (Index == INDEX_NONE)
+		{
+			return EFlowDataPinResolveResult::FailedInsufficientValues;
+		}
+
+		Getter(Index);
+		return EFlowDataPinResolveResult::Success;
+	}
+
 	// -----------------------------------------------------------------------
 	// Numeric Validation & Clamping
 	// -----------------------------------------------------------------------
@@ -352,6 +370,59 @@ namespace FlowPinType
 			return EFlowDataPinResolveResult::FailedMismatchedType;
 		}
 
+		/* Single value version of ExtractFromProperty, writes straight to OutValue without building the array of values. */
+		static EFlowDataPinResolveResult ExtractSingleFromProperty(const FProperty* Property, const void* Container, EFlowSingleFromArray SingleFromArray, ValueType& OutValue)
+		{
+			// 1. Wrapper struct
+			if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+			{
+				if (StructProp->Struct == WrapperType::StaticStruct())
+				{
+					const WrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<WrapperType>(Container);
+					return PickSingleValue(Wrapper->Values.Num(), SingleFromArray, [&](const int32 Index) { OutValue = Wrapper->Values[Index]; });
+				}
+
+				// #FlowDataPinLegacy - support sourcing from old property wrappers For Now(tm)
+				static const UScriptStruct* OldPropStruct = LegacyWrapperType::StaticStruct();
+				if (StructProp->Struct->IsChildOf(OldPropStruct))
+				{
+					const LegacyWrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<LegacyWrapperType>(Container);
+					return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = Wrapper->Value; });
+				}
+				// --
+			}
+
+			// 2. Direct property
+			if (const PropertyType* Prop = CastField<PropertyType>(Property))
+			{
+				return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = *Prop->template ContainerPtrToValuePtr<ValueType>(Container); });
+			}
+
+			// 3. Array of property
+			if (const FArrayProperty* ArrProp = CastField<FArrayProperty>(Property))
+			{
+				if (const PropertyType* Inner = CastField<PropertyType>(ArrProp->Inner))
+				{
+					FScriptArrayHelper ArrHelper(ArrProp, ArrProp->ContainerPtrToValuePtr<void>(Container));
+					return PickSingleValue(ArrHelper.Num(), SingleFromArray, [&](const int32 Index) { OutValue = *Inner->template ContainerPtrToValuePtr<ValueType>(ArrHelper.GetRawPtr(Index)); });
+				}
+			}
+
+			return EFlowDataPinResolveResult::FailedMismatchedType;
+		}
+
+		/* Single value version of ExtractValues, for values already stored in the wrapper of this pin type. */
+		static EFlowDataPinResolveResult ExtractSingleFromValue(const FFlowDataPinValue& Value, EFlowSingleFromArray SingleFromArray, ValueType& OutValue)
+		{
+			if (Value.GetPinTypeName() == TPinType::GetPinTypeNameStatic())
+			{
+				const WrapperType& Wrapper = static_cast<const WrapperType&>(Value);
+				return PickSingleValue(Wrapper.Values.Num(), SingleFromArray, [&](const int32 Index) { OutValue = Wrapper.Values[Index]; });
+			}
+
+			return EFlowDataPinResolveResult::FailedMismatchedType;
+		}
+
 		static EFlowDataPinResolveResult ExtractValues(const FFlowDataPinResult& DataPinResult, TArray<ValueType>& OutValues, EFlowSingleFromArray SingleFromArray)
 		{
 			if (!IsSuccess(DataPinResult.Result))
@@ -562,6 +633,46 @@ namespace FlowPinType
 
 			return EFlowDataPinResolveResult::FailedMismatchedType;
 		}
+
+		static EFlowDataPinResolveResult ExtractSingleFromProperty(const FProperty* Property, const void* Container, EFlowSingleFromArray SingleFromArray, ValueType& OutValue)
+		{
+			static const UScriptStruct* ValueStruct = TBaseStructure<ValueType>::Get();
+
+			if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+			{
+				static const UScriptStruct* WrapperStruct = TBaseStructure<WrapperType>::Get();
+				if (StructProp->Struct == WrapperStruct)
+				{
+					const WrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<WrapperType>(Container);
+					return PickSingleValue(Wrapper->Values.Num(), SingleFromArray, [&](const int32 Index) { OutValue = Wrapper->Values[Index]; });
+				}
+
+				if (StructProp->Struct == ValueStruct)
+				{
+					return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = *StructProp->ContainerPtrToValuePtr<ValueType>(Container); });
+				}
+
+				// #FlowDataPinLegacy - support sourcing from old property wrappers For Now(tm)
+				static const UScriptStruct* OldPropStruct = LegacyWrapperType::StaticStruct();
+				if (StructProp->Struct->IsChildOf(OldPropStruct))
+				{
+					const LegacyWrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<LegacyWrapperType>(Container);
+					return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = Wrapper->Value; });
+				}
+				// --
+			}
+			else if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+			{
+				const FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner);
+				if (InnerStruct && InnerStruct->Struct == ValueStruct)
+				{
+					FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Container));
+					return PickSingleValue(Helper.Num(), SingleFromArray, [&](const int32 Index) { OutValue = *reinterpret_cast<const ValueType*>(Helper.GetRawPtr(Index)); });
+				}
+			}
+
+			return EFlowDataPinResolveResult::FailedMismatchedType;
+		}
 	};
 
 	// -----------------------------------------------------------------------
@@ -651,6 +762,50 @@ namespace FlowPinType
 
 			return EFlowDataPinResolveResult::FailedMismatchedType;
 		}
+
+		static EFlowDataPinResolveResult ExtractSingleFromProperty(const FProperty* Property, const void* Container, EFlowSingleFromArray SingleFromArray, FName& OutValue)
+		{
+			const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+			if (StructProp && StructProp->Struct == WrapperType::StaticStruct())
+			{
+				const WrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<WrapperType>(Container);
+				return PickSingleValue(Wrapper->Values.Num(), SingleFromArray, [&](const int32 Index) { OutValue = Wrapper->Values[Index]; });
+			}
+
+			// #FlowDataPinLegacy - support sourcing from old property wrappers For Now(tm)
+			static const UScriptStruct* OldPropStruct = LegacyWrapperType::StaticStruct();
+			if (StructProp && StructProp->Struct->IsChildOf(OldPropStruct))
+			{
+				const LegacyWrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<LegacyWrapperType>(Container);
+				return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = Wrapper->Value; });
+			}
+			// --
+
+			if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+			{
+				return PickSingleValue(1, SingleFromArray, [&](const int32)
+				{
+					const void* ContainerPtr = EnumProp->ContainerPtrToValuePtr<uint8>(Container);
+					const int64 RawValue = EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue_InContainer(ContainerPtr);
+					OutValue = FName(EnumProp->GetEnum()->GetAuthoredNameStringByValue(RawValue));
+				});
+			}
+
+			if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+			{
+				if (const FEnumProperty* Inner = CastField<FEnumProperty>(ArrayProp->Inner))
+				{
+					FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Container));
+					return PickSingleValue(Helper.Num(), SingleFromArray, [&](const int32 Index)
+					{
+						const int64 RawValue = Inner->GetUnderlyingProperty()->GetSignedIntPropertyValue(Helper.GetRawPtr(Index));
+						OutValue = FName(Inner->GetEnum()->GetAuthoredNameStringByValue(RawValue));
+					});
+				}
+			}
+
+			return EFlowDataPinResolveResult::FailedMismatchedType;
+		}
 	};
 
 	/* GameplayTag. */
@@ -696,6 +851,10 @@ namespace FlowPinType
 		using ValueType = PinType::ValueType;
 		using WrapperType = FFlowDataPinValue_GameplayTagContainer;
 
+		// Wrapper holds a single container instead of array of values, so it's resolved only through ExtractValues
+		static EFlowDataPinResolveResult ExtractSingleFromProperty(const FProperty* Property, const void* Container, EFlowSingleFromArray SingleFromArray, ValueType& OutValue) = delete;
+		static EFlowDataPinResolveResult ExtractSingleFromValue(const FFlowDataPinValue& Value, EFlowSingleFromArray SingleFromArray, ValueType& OutValue) = delete;
+
 		static EFlowDataPinResolveResult ExtractFromProperty(const FProperty* Property, const void* Container, TArray<ValueType>& OutValues)
 		{
 			static const UScriptStruct* ValueStruct = TBaseStructure<ValueType>::Get();
@@ -792,7 +951,7 @@ namespace FlowPinType
 						if constexpr (std::is_same_v<std::decay_t<decltype(Path)>, FSoftObjectPath> ||
 							std::is_same_v<std::decay_t<decltype(Path)>, FSoftClassPath>)
 						{
-							OutValues.Add(Cast<TValueObjectType>(Path.ResolveObject()));
+							OutValues.Add(Cast<TValueObjectType>(FlowSoftReference::ResolveOrDefer(Path)));
 						}
 						else
 						{
@@ -834,7 +993,7 @@ namespace FlowPinType
 					for (int32 i = 0; i < Num; ++i)
 					{
 						const FSoftObjectPath Path = InnerSoftProp->GetPropertyValue(ArrHelper.GetRawPtr(i)).ToSoftObjectPath();
-						OutValues.Add(Cast<TValueObjectType>(Path.TryLoad()));
+						OutValues.Add(Cast<TValueObjectType>(FlowSoftReference::LoadOrDefer(Path)));
 					}
 					return EFlowDataPinResolveResult::Success;
 				}
@@ -859,7 +1018,7 @@ namespace FlowPinType
 			else if (const TSoftProperty* SoftObjProp = CastField<TSoftProperty>(Property))
 			{
 				const FSoftObjectPath Path = SoftObjProp->GetPropertyValue_InContainer(Container).ToSoftObjectPath();
-				OutValues = { Cast<TValueObjectType>(Path.TryLoad()) };
+				OutValues = { Cast<TValueObjectType>(FlowSoftReference::LoadOrDefer(Path)) };
 				return EFlowDataPinResolveResult::Success;
 			}
 			else if (const FWeakObjectProperty* WeakProp = CastField<FWeakObjectProperty>(Property))
@@ -871,6 +1030,93 @@ namespace FlowPinType
 			return EFlowDataPinResolveResult::FailedMismatchedType;
 		}
 
+		static EFlowDataPinResolveResult ExtractSingleFromProperty(const FProperty* Property, const void* Container, EFlowSingleFromArray SingleFromArray, ValueType& OutValue)
+		{
+			if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+			{
+				if (StructProp->Struct == WrapperType::StaticStruct())
+				{
+					const WrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<WrapperType>(Container);
+					return PickSingleValue(Wrapper->Values.Num(), SingleFromArray, [&](const int32 Index) { OutValue = ResolveWrapperValue(Wrapper->Values[Index]); });
+				}
+
+				// #FlowDataPinLegacy - support sourcing from old property wrappers For Now(tm)
+				static const UScriptStruct* OldPropStruct = LegacyWrapperType::StaticStruct();
+				if (StructProp->Struct->IsChildOf(OldPropStruct))
+				{
+					const LegacyWrapperType* Wrapper = StructProp->ContainerPtrToValuePtr<LegacyWrapperType>(Container);
+					return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = Cast<TValueObjectType>(Wrapper->GetObjectValue()); });
+				}
+				// --
+			}
+
+			if (const FArrayProperty* ArrProp = CastField<FArrayProperty>(Property))
+			{
+				FScriptArrayHelper ArrHelper(ArrProp, ArrProp->ContainerPtrToValuePtr<void>(Container));
+
+				if (const TProperty* InnerObjProp = CastField<TProperty>(ArrProp->Inner))
+				{
+					return PickSingleValue(ArrHelper.Num(), SingleFromArray, [&](const int32 Index) { OutValue = Cast<TValueObjectType>(InnerObjProp->GetObjectPropertyValue(ArrHelper.GetRawPtr(Index))); });
+				}
+				else if (const TSoftProperty* InnerSoftProp = CastField<TSoftProperty>(ArrProp->Inner))
+				{
+					return PickSingleValue(ArrHelper.Num(), SingleFromArray, [&](const int32 Index)
+					{
+						const FSoftObjectPath Path = InnerSoftProp->GetPropertyValue(ArrHelper.GetRawPtr(Index)).ToSoftObjectPath();
+						OutValue = Cast<TValueObjectType>(FlowSoftReference::LoadOrDefer(Path));
+					});
+				}
+				else if (const FWeakObjectProperty* InnerWeakProp = CastField<FWeakObjectProperty>(ArrProp->Inner))
+				{
+					return PickSingleValue(ArrHelper.Num(), SingleFromArray, [&](const int32 Index) { OutValue = Cast<TValueObjectType>(InnerWeakProp->GetPropertyValue(ArrHelper.GetRawPtr(Index)).Get()); });
+				}
+			}
+
+			if (const TProperty* ObjProp = CastField<TProperty>(Property))
+			{
+				return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = Cast<TValueObjectType>(ObjProp->GetObjectPropertyValue_InContainer(Container)); });
+			}
+			else if (const TSoftProperty* SoftObjProp = CastField<TSoftProperty>(Property))
+			{
+				return PickSingleValue(1, SingleFromArray, [&](const int32)
+				{
+					const FSoftObjectPath Path = SoftObjProp->GetPropertyValue_InContainer(Container).ToSoftObjectPath();
+					OutValue = Cast<TValueObjectType>(FlowSoftReference::LoadOrDefer(Path));
+				});
+			}
+			else if (const FWeakObjectProperty* WeakProp = CastField<FWeakObjectProperty>(Property))
+			{
+				return PickSingleValue(1, SingleFromArray, [&](const int32) { OutValue = Cast<TValueObjectType>(WeakProp->GetPropertyValue_InContainer(Container).Get()); });
+			}
+
+			return EFlowDataPinResolveResult::FailedMismatchedType;
+		}
+
+		static EFlowDataPinResolveResult ExtractSingleFromValue(const FFlowDataPinValue& Value, EFlowSingleFromArray SingleFromArray, ValueType& OutValue)
+		{
+			if (Value.GetPinTypeName() == TPinType::GetPinTypeNameStatic())
+			{
+				const WrapperType& Wrapper = static_cast<const WrapperType&>(Value);
+				return PickSingleValue(Wrapper.Values.Num(), SingleFromArray, [&](const int32 Index) { OutValue = ResolveWrapperValue(Wrapper.Values[Index]); });
+			}
+
+			return EFlowDataPinResolveResult::FailedMismatchedType;
+		}
+
+		/* Wrapper values are either object pointers or soft paths, which are only resolved (never loaded) like in ExtractValues. */
+		template <typename TWrapperValue>
+		static ValueType ResolveWrapperValue(const TWrapperValue& WrapperValue)
+		{
+			if constexpr (std::is_same_v<TWrapperValue, FSoftObjectPath> || std::is_same_v<TWrapperValue, FSoftClassPath>)
+			{
+				return Cast<TValueObjectType>(FlowSoftReference::ResolveOrDefer(WrapperValue));
+			}
+			else
+			{
+				return Cast<TValueObjectType>(WrapperValue);
+			}
+		}
+
 		static EFlowDataPinResolveResult ExtractValues(const FFlowDataPinResult& DataPinResult, TArray<ValueType>& OutValues, EFlowSingleFromArray SingleFromArray)
 		{
 			if (!IsSuccess(DataPinResult.Result))
@@ -891,7 +1137,7 @@ namespace FlowPinType
 						if constexpr (std::is_same_v<std::decay_t<decltype(Path)>, FSoftObjectPath> ||
 							std::is_same_v<std::decay_t<decltype(Path)>, FSoftClassPath>)
 						{
-							OutValues.Add(Cast<TValueObjectType>(Path.ResolveObject()));
+							OutValues.Add(Cast<TValueObjectType>(FlowSoftReference::ResolveOrDefer(Path)));
 						}
 						else
 						{
@@ -911,7 +1157,7 @@ namespace FlowPinType
 					if constexpr (std::is_same_v<std::decay_t<decltype(Path)>, FSoftObjectPath> ||
 						std::is_same_v<std::decay_t<decltype(Path)>, FSoftClassPath>)
 					{
-						OutValues.Add(Cast<TValueObjectType>(Path.ResolveObject()));
+						OutValues.Add(Cast<TValueObjectType>(FlowSoftReference::ResolveOrDefer(Path)));
 					}
 					else
 					{
@@ -929,6 +1175,38 @@ namespace FlowPinType
 	template <> struct FFlowDataPinValueTraits<FFlowPinType_Object> : public FFlowObjectTraitsBase<FFlowPinType_Object, FObjectProperty, FSoftObjectProperty, UObject> {};
 	template <> struct FFlowDataPinValueTraits<FFlowPinType_Class> : public FFlowObjectTraitsBase<FFlowPinType_Class, FClassProperty, FSoftClassProperty, UClass> {};
 
+	// -----------------------------------------------------------------------
+	// Value Sink
+	// -----------------------------------------------------------------------
+
+	/* Pin types which single values can be resolved straight into the caller storage, see FFlowDataPinValueSink. */
+	template <typename TPinType>
+	concept CFlowPinTypeWithValueSink = requires(const FProperty* Property, const void* Container, const FFlowDataPinValue& Value, typename TPinType::ValueType& OutValue)
+	{
+		FFlowDataPinValueTraits<TPinType>::ExtractSingleFromProperty(Property, Container, EFlowSingleFromArray::LastValue, OutValue);
+		FFlowDataPinValueTraits<TPinType>::ExtractSingleFromValue(Value, EFlowSingleFromArray::LastValue, OutValue);
+	};
+
+	template <typename TPinType> requires CFlowPinTypeWithValueSink<TPinType>
+	FFlowDataPinValueSink MakeValueSink(typename TPinType::ValueType& OutValue, EFlowSingleFromArray SingleFromArray)
+	{
+		using TValue = typename TPinType::ValueType;
+		using Traits = FFlowDataPinValueTraits<TPinType>;
+
+		return FFlowDataPinValueSink(
+			TPinType::GetPinTypeNameStatic().Name,
+			SingleFromArray,
+			[](const FProperty* Property, const void* Container, EFlowSingleFromArray Policy, void* Value)
+			{
+				return Traits::ExtractSingleFromProperty(Property, Container, Policy, *static_cast<TValue*>(Value));
+			},
+			[](const FFlowDataPinValue& PinValue, EFlowSingleFromArray Policy, void* Value)
+			{
+				return Traits::ExtractSingleFromValue(PinValue, Policy, *static_cast<TValue*>(Value));
+			},
+			&OutValue);
+	}
+
 	// -----------------------------------------------------------------------
 	// Value Extractors
 	// -----------------------------------------------------------------------
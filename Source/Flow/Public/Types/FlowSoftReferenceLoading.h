@@ -0,0 +1,53 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+#pragma once
+
+#include "FlowLogChannels.h"
+#include "UObject/SoftObjectPath.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Data Pin Sync Loads"), STAT_FlowDataPinSyncLoads, STATGROUP_Flow, FLOW_API);
+
+/**
+ * Resolving soft references of data pin values.
+ * Object, Class and Enum pins used to load unloaded assets synchronously, stalling the game thread.
+ * While FFlowDeferredLoadScope is active, unloaded assets are collected instead, so the caller can stream them in and resolve pins again.
+ */
+namespace FlowSoftReference
+{
+	/* Returns the object, loading it synchronously if needed. Load is skipped and the path is collected, if FFlowDeferredLoadScope is active. */
+	FLOW_API UObject* LoadOrDefer(const FSoftObjectPath& Path);
+
+	/* Returns the object only if it's already in memory. Unresolved path is collected, if FFlowDeferredLoadScope is active. */
+	FLOW_API UObject* ResolveOrDefer(const FSoftObjectPath& Path);
+
+	/* Synchronous loads executed while resolving data pins, since the start or the last reset. */
+	FLOW_API int32 GetNumSyncLoads();
+	FLOW_API void ResetNumSyncLoads();
+}
+
+/**
+ * Collects soft references that data pins couldn't resolve without a synchronous load.
+ * Scopes can be nested, only the innermost one collects paths. Game thread only, scopes opened on other threads do nothing.
+ */
+class FLOW_API FFlowDeferredLoadScope
+{
+public:
+	FFlowDeferredLoadScope();
+	~FFlowDeferredLoadScope();
+
+	FFlowDeferredLoadScope(const FFlowDeferredLoadScope&) = delete;
+	FFlowDeferredLoadScope& operator=(const FFlowDeferredLoadScope&) = delete;
+
+	static bool IsActive() { return Active != nullptr; }
+
+	/* Returns true if the path has been collected by the active scope. */
+	static bool TryDefer(const FSoftObjectPath& Path);
+
+	const TArray<FSoftObjectPath>& GetDeferredPaths() const { return DeferredPaths; }
+
+private:
+	TArray<FSoftObjectPath> DeferredPaths;
+	FFlowDeferredLoadScope* OuterScope = nullptr;
+	bool bRegistered = false;
+
+	static FFlowDeferredLoadScope* Active;
+};
@@ -0,0 +1,134 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+#pragma once
+
+#include "Tickable.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UWorld;
+
+/**
+ * Identifies a timer scheduled in the FFlowTimerWheel.
+ * Handle of the finished or cleared timer is safe to use, it's simply not valid anymore.
+ */
+struct FLOW_API FFlowTimerHandle
+{
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+
+private:
+	friend class FFlowTimerWheel;
+
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+};
+
+/**
+ * Hierarchical timer wheel driving Flow timers of a single world, owned by the Flow Subsystem.
+ * Replaces separate FTimerManager entries per node, so thousands of timers cost only as much as timers expiring in the current frame.
+ * Time is read from UWorld::GetTimeSeconds(), so timers are paused and dilated exactly like the world.
+ *
+ * Mirrors FTimerManager rules:
+ * - timer fires in the first tick when its expire time is reached
+ * - looping timer fires multiple times if a single frame took longer than its rate
+ * - timers set while the wheel is ticking are scheduled after the tick, so they never fire in the same tick
+ * - timer never fires in the frame it has been set, i.e. zero delay works like FTimerManager::SetTimerForNextTick
+ */
+class FLOW_API FFlowTimerWheel : public FTickableGameObject
+{
+public:
+	explicit FFlowTimerWheel(UWorld* InWorld);
+
+	FFlowTimerWheel(const FFlowTimerWheel&) = delete;
+	FFlowTimerWheel& operator=(const FFlowTimerWheel&) = delete;
+
+	/**
+	 * Schedules a new timer, handle set previously is cleared first.
+	 * @param Rate Time between calls. First call is clamped to the next wheel tick after the current world time, so it never happens in this frame.
+	 * @param FirstDelay Time until the first call, if negative the Rate is used.
+	 */
+	void SetTimer(FFlowTimerHandle& InOutHandle, FSimpleDelegate&& Callback, const float Rate, const bool bLoop, const float FirstDelay = -1.0f);
+	void ClearTimer(FFlowTimerHandle& InOutHandle);
+
+	bool IsTimerActive(const FFlowTimerHandle& Handle) const;
+	float GetTimerRemaining(const FFlowTimerHandle& Handle) const;
+	float GetTimerElapsed(const FFlowTimerHandle& Handle) const;
+
+	int32 GetNumTimers() const { return NumActiveTimers; }
+	UWorld* GetWorld() const { return World.Get(); }
+
+	/* Fires all timers expired until given world time. */
+	void Advance(const double Now);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	virtual TStatId GetStatId() const override;
+	// --
+
+private:
+	enum class ETimerState : uint8
+	{
+		Free,
+		Scheduled,
+		Pending,
+		Executing,
+		ExecutingCleared
+	};
+
+	struct FTimer
+	{
+		FSimpleDelegate Callback;
+		double ExpireTime = 0.0;
+		float Rate = 0.0f;
+		bool bLoop = false;
+		ETimerState State = ETimerState::Free;
+		uint32 Serial = 0;
+
+		/* Bucket list links, or a free list link for free timers. */
+		int32 Bucket = INDEX_NONE;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+	};
+
+	/* Each level has 256 buckets, a single bucket of the next level covers the entire previous level.
+	 * With 1/64s ticks, levels cover 4s, 17min and 3 days. Timers beyond that wait in the overflow bucket. */
+	static constexpr double TicksPerSecond = 64.0;
+	static constexpr int32 BucketBits = 8;
+	static constexpr int32 NumBuckets = 1 << BucketBits;
+	static constexpr int32 NumLevels = 3;
+	static constexpr int32 OverflowBucket = NumLevels * NumBuckets;
+
+	TWeakObjectPtr<UWorld> World;
+
+	TArray<FTimer> Timers;
+	int32 FirstFreeTimer = INDEX_NONE;
+	int32 NumActiveTimers = 0;
+
+	/* Heads of bucket lists, including the overflow bucket. */
+	TArray<int32> BucketHeads;
+
+	/* Tick of the bucket at level 0 currently being processed. Buckets of earlier ticks are already empty. */
+	int64 CurrentTick = 0;
+
+	bool bIsAdvancing = false;
+
+	/* Timers set while advancing, scheduled once the advance completes. */
+	TArray<int32> PendingTimers;
+
+	double GetTime() const;
+	static int64 TimeToTick(const double Time) { return FMath::FloorToInt64(Time * TicksPerSecond); }
+
+	const FTimer* FindTimer(const FFlowTimerHandle& Handle) const;
+
+	int32 AllocateTimer();
+	void FreeTimer(const int32 TimerIndex);
+
+	void Schedule(const int32 TimerIndex);
+	void Link(const int32 TimerIndex, const int32 Bucket);
+	void Unlink(const int32 TimerIndex);
+
+	void CascadeBucket(const int32 Bucket);
+	void CollectExpired(const int32 Bucket, const double Now, const bool bExpireAll, TArray<int32, TInlineAllocator<32>>& OutExpired);
+	void Execute(const int32 TimerIndex, const double Now);
+};
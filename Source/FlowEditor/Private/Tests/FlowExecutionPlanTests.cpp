@@ -0,0 +1,172 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Graph/FlowGraph.h"
+#include "Graph/FlowGraphSchema_Actions.h"
+#include "Graph/Nodes/FlowGraphNode.h"
+
+#include "FlowAsset.h"
+#include "Asset/FlowExecutionPlan.h"
+#include "Nodes/FlowNode.h"
+#include "Nodes/Graph/FlowNode_FormatText.h"
+#include "Nodes/Route/FlowNode_ExecutionSequence.h"
+#include "Nodes/Route/FlowNode_Reroute.h"
+
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Misc/AutomationTest.h"
+#include "ScopedTransaction.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define LOCTEXT_NAMESPACE "FlowExecutionPlanTests"
+
+namespace FlowExecutionPlanTests
+{
+	UFlowNode* AddNode(UFlowAsset& FlowAsset, const UClass* NodeClass)
+	{
+		const UFlowGraphNode* GraphNode = FFlowGraphSchemaAction_NewNode::CreateNode(FlowAsset.GetGraph(), nullptr, NodeClass, FVector2f::ZeroVector, false);
+		return CastChecked<UFlowNode>(GraphNode->GetFlowNodeBase());
+	}
+
+	/* Returns Nth graph pin of the node with given direction and kind. */
+	UEdGraphPin* FindGraphPin(const UFlowNode& FlowNode, const EEdGraphPinDirection Direction, const bool bExecPin, int32 PinIndex = 0)
+	{
+		for (UEdGraphPin* Pin : FlowNode.GetGraphNode()->Pins)
+		{
+			if (Pin->Direction == Direction && FFlowPin::IsExecPinCategory(Pin->PinType.PinCategory) == bExecPin && PinIndex-- == 0)
+			{
+				return Pin;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/* Reference implementation: scans Connections of every node, as FindConnectedNodeForPinUncached did before the reverse index. */
+	TArray<FConnectedPin> ScanIncomingConnections(const UFlowAsset& FlowAsset, const FConnectedPin& ToPin)
+	{
+		TArray<FConnectedPin> ConnectedPins;
+
+		for (const TPair<FGuid, UFlowNode*>& Node : FlowAsset.GetNodes())
+		{
+			if (IsValid(Node.Value))
+			{
+				for (const TPair<FName, FConnectedPin>& Connection : Node.Value->GetConnections())
+				{
+					if (Connection.Value == ToPin)
+					{
+						ConnectedPins.Emplace(Node.Key, Connection.Key);
+					}
+				}
+			}
+		}
+
+		return ConnectedPins;
+	}
+
+	void TestPinsMatchScan(FAutomationTestBase& Test, const FFlowExecutionPlan& Plan, const UFlowAsset& FlowAsset, const UFlowNode& FlowNode, const TArray<FFlowPin>& Pins, const FString& Context)
+	{
+		for (const FFlowPin& Pin : Pins)
+		{
+			const FConnectedPin ToPin(FlowNode.GetGuid(), Pin.PinName);
+			const TArray<FConnectedPin> IndexedPins(Plan.GetIncomingConnections(ToPin));
+
+			const FString What = FString::Printf(TEXT("%s: incoming connections of %s.%s"), *Context, *FlowNode.GetName(), *Pin.PinName.ToString());
+			Test.TestTrue(What, IndexedPins == ScanIncomingConnections(FlowAsset, ToPin));
+		}
+	}
+
+	void TestIndexMatchesScan(FAutomationTestBase& Test, const UFlowAsset& FlowAsset, const FString& Context)
+	{
+		const TSharedRef<const FFlowExecutionPlan> Plan = FlowAsset.GetOrBuildExecutionPlan();
+		for (const TPair<FGuid, UFlowNode*>& Node : FlowAsset.GetNodes())
+		{
+			if (IsValid(Node.Value))
+			{
+				TestPinsMatchScan(Test, *Plan, FlowAsset, *Node.Value, Node.Value->GetInputPins(), Context);
+				TestPinsMatchScan(Test, *Plan, FlowAsset, *Node.Value, Node.Value->GetOutputPins(), Context);
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlowExecutionPlanIncomingConnectionsTest, "Flow.ExecutionPlan.IncomingConnections",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFlowExecutionPlanIncomingConnectionsTest::RunTest(const FString& Parameters)
+{
+	using namespace FlowExecutionPlanTests;
+
+	if (!GEditor)
+	{
+		AddError(TEXT("Test requires the editor, as it verifies the index after undo and redo"));
+		return false;
+	}
+
+	UFlowAsset* FlowAsset = NewObject<UFlowAsset>(GetTransientPackage(), NAME_None, RF_Transient | RF_Transactional);
+	UFlowGraph::CreateGraph(FlowAsset);
+
+	UFlowNode* StartNode = FlowAsset->GetDefaultEntryNode();
+	UFlowNode* SequenceNode = AddNode(*FlowAsset, UFlowNode_ExecutionSequence::StaticClass());
+	UFlowNode* RerouteNode = AddNode(*FlowAsset, UFlowNode_Reroute::StaticClass());
+	UFlowNode* TargetNode = AddNode(*FlowAsset, UFlowNode_Reroute::StaticClass());
+	UFlowNode* SourceTextNode = AddNode(*FlowAsset, UFlowNode_FormatText::StaticClass());
+	UFlowNode* FirstTextNode = AddNode(*FlowAsset, UFlowNode_FormatText::StaticClass());
+	UFlowNode* SecondTextNode = AddNode(*FlowAsset, UFlowNode_FormatText::StaticClass());
+
+	if (!TestNotNull(TEXT("Start node"), StartNode))
+	{
+		return false;
+	}
+
+	// exec input connected from two outputs, data output connected into two inputs
+	UEdGraphPin* SequenceOutput = FindGraphPin(*SequenceNode, EGPD_Output, true);
+	const TPair<UEdGraphPin*, UEdGraphPin*> Links[] = {
+		{FindGraphPin(*StartNode, EGPD_Output, true), FindGraphPin(*SequenceNode, EGPD_Input, true)},
+		{SequenceOutput, FindGraphPin(*TargetNode, EGPD_Input, true)},
+		{FindGraphPin(*RerouteNode, EGPD_Output, true), FindGraphPin(*TargetNode, EGPD_Input, true)},
+		{FindGraphPin(*SourceTextNode, EGPD_Output, false), FindGraphPin(*FirstTextNode, EGPD_Input, false)},
+		{FindGraphPin(*SourceTextNode, EGPD_Output, false), FindGraphPin(*SecondTextNode, EGPD_Input, false)}
+	};
+
+	for (const TPair<UEdGraphPin*, UEdGraphPin*>& Link : Links)
+	{
+		if (!TestTrue(TEXT("Pins to link exist"), Link.Key && Link.Value))
+		{
+			return false;
+		}
+		Link.Key->MakeLinkTo(Link.Value);
+	}
+	FlowAsset->GetGraph()->NotifyGraphChanged();
+
+	TestTrue(TEXT("Connections harvested"), TargetNode->IsInputConnected(UFlowNode::DefaultInputPin.PinName));
+	TestIndexMatchesScan(*this, *FlowAsset, TEXT("Built"));
+
+	// edit connections in a transaction, then undo and redo it
+	{
+		const FScopedTransaction Transaction(LOCTEXT("BreakLinks", "Break Links"));
+		FlowAsset->Modify();
+		SequenceNode->GetGraphNode()->Modify();
+		TargetNode->GetGraphNode()->Modify();
+
+		SequenceOutput->BreakAllPinLinks();
+		FlowAsset->GetGraph()->NotifyGraphChanged();
+	}
+	TestIndexMatchesScan(*this, *FlowAsset, TEXT("Edited"));
+
+	TestTrue(TEXT("Undo"), GEditor->UndoTransaction());
+	FlowAsset->GetGraph()->NotifyGraphChanged();
+	TestIndexMatchesScan(*this, *FlowAsset, TEXT("Undone"));
+
+	TestTrue(TEXT("Redo"), GEditor->RedoTransaction());
+	FlowAsset->GetGraph()->NotifyGraphChanged();
+	TestIndexMatchesScan(*this, *FlowAsset, TEXT("Redone"));
+
+	FlowAsset->MarkAsGarbage();
+	return true;
+}
+
+#undef LOCTEXT_NAMESPACE
+
+#endif